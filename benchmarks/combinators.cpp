@@ -0,0 +1,280 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <thousandeyes/futures/all.h>
+#include <thousandeyes/futures/allOrFail.h>
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/PollingExecutorWithPartialSort.h>
+#include <thousandeyes/futures/reduce.h>
+#include <thousandeyes/futures/then.h>
+
+using std::future;
+using std::make_shared;
+using std::promise;
+using std::shared_ptr;
+using std::vector;
+using std::chrono::microseconds;
+
+using thousandeyes::futures::all;
+using thousandeyes::futures::allOrFail;
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::PollingExecutorWithPartialSort;
+using thousandeyes::futures::reduce;
+using thousandeyes::futures::then;
+using thousandeyes::futures::detail::InvokerWithNewThread;
+using thousandeyes::futures::detail::InvokerWithSingleThread;
+
+namespace {
+
+using PartialSortExecutor =
+    PollingExecutorWithPartialSort<InvokerWithNewThread, InvokerWithSingleThread>;
+
+// The polling timeouts (q), in microseconds, that every executor is measured with
+const std::vector<int64_t> kQs{100, 1000, 10000};
+
+future<int> chain(shared_ptr<Executor> executor, future<int> f, int64_t depth)
+{
+    for (int64_t i = 0; i < depth; ++i) {
+        f = then(executor, std::move(f), [](future<int> g) { return g.get() + 1; });
+    }
+    return f;
+}
+
+} // namespace
+
+//! Measures how many independent continuations complete per second, when their
+//! inputs become ready after the continuations are attached.
+template <class TExecutor>
+void BM_ThenThroughput(benchmark::State& state)
+{
+    auto executor = make_shared<TExecutor>(microseconds(state.range(0)));
+    const auto count = state.range(1);
+
+    for (auto _ : state) {
+        vector<promise<int>> promises(count);
+
+        vector<future<int>> results;
+        results.reserve(count);
+        for (auto& p : promises) {
+            results.push_back(then(executor, p.get_future(), [](future<int> f) {
+                return f.get() + 1;
+            }));
+        }
+
+        for (auto& p : promises) {
+            p.set_value(1821);
+        }
+
+        for (auto& f : results) {
+            benchmark::DoNotOptimize(f.get());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+    executor->stop();
+}
+
+BENCHMARK_TEMPLATE(BM_ThenThroughput, DefaultExecutor)
+    ->ArgsProduct({kQs, {1000}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThenThroughput, PartialSortExecutor)
+    ->ArgsProduct({kQs, {1000}})
+    ->UseRealTime();
+
+//! Measures how long a chain of the given depth takes to complete, where every
+//! continuation waits for the previous one.
+template <class TExecutor>
+void BM_ChainingDepth(benchmark::State& state)
+{
+    auto executor = make_shared<TExecutor>(microseconds(state.range(0)));
+    const auto depth = state.range(1);
+
+    for (auto _ : state) {
+        promise<int> p;
+
+        auto f = chain(executor, p.get_future(), depth);
+        p.set_value(0);
+
+        benchmark::DoNotOptimize(f.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * depth);
+    executor->stop();
+}
+
+BENCHMARK_TEMPLATE(BM_ChainingDepth, DefaultExecutor)
+    ->ArgsProduct({kQs, {1, 10, 100}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ChainingDepth, PartialSortExecutor)
+    ->ArgsProduct({kQs, {1, 10, 100}})
+    ->UseRealTime();
+
+//! Measures how long all() takes to complete on a container of the given width,
+//! whose futures become ready after all() is called.
+template <class TExecutor>
+void BM_AllWidth(benchmark::State& state)
+{
+    auto executor = make_shared<TExecutor>(microseconds(state.range(0)));
+    const auto width = state.range(1);
+
+    for (auto _ : state) {
+        vector<promise<int>> promises(width);
+
+        vector<future<int>> futures;
+        futures.reserve(width);
+        for (auto& p : promises) {
+            futures.push_back(p.get_future());
+        }
+
+        auto f = all(executor, std::move(futures));
+
+        for (auto& p : promises) {
+            p.set_value(1821);
+        }
+
+        benchmark::DoNotOptimize(f.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * width);
+    executor->stop();
+}
+
+BENCHMARK_TEMPLATE(BM_AllWidth, DefaultExecutor)
+    ->ArgsProduct({kQs, {10, 1000, 10000}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_AllWidth, PartialSortExecutor)
+    ->ArgsProduct({kQs, {10, 1000, 10000}})
+    ->UseRealTime();
+
+//! Measures how long allOrFail() takes to complete on a container of the given width,
+//! whose futures become ready after allOrFail() is called; compare with BM_AllWidth
+//! for the cost of checking every future for an exception.
+template <class TExecutor>
+void BM_AllOrFailWidth(benchmark::State& state)
+{
+    auto executor = make_shared<TExecutor>(microseconds(state.range(0)));
+    const auto width = state.range(1);
+
+    for (auto _ : state) {
+        vector<promise<int>> promises(width);
+
+        vector<future<int>> futures;
+        futures.reserve(width);
+        for (auto& p : promises) {
+            futures.push_back(p.get_future());
+        }
+
+        auto f = allOrFail(executor, std::move(futures));
+
+        for (auto& p : promises) {
+            p.set_value(1821);
+        }
+
+        benchmark::DoNotOptimize(f.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * width);
+    executor->stop();
+}
+
+BENCHMARK_TEMPLATE(BM_AllOrFailWidth, DefaultExecutor)
+    ->ArgsProduct({kQs, {10, 1000, 10000}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_AllOrFailWidth, PartialSortExecutor)
+    ->ArgsProduct({kQs, {10, 1000, 10000}})
+    ->UseRealTime();
+
+//! Measures how long reduce() takes to sum a container of the given width, whose
+//! futures become ready after reduce() is called.
+template <class TExecutor>
+void BM_ReduceWidth(benchmark::State& state)
+{
+    auto executor = make_shared<TExecutor>(microseconds(state.range(0)));
+    const auto width = state.range(1);
+
+    for (auto _ : state) {
+        vector<promise<int>> promises(width);
+
+        vector<future<int>> futures;
+        futures.reserve(width);
+        for (auto& p : promises) {
+            futures.push_back(p.get_future());
+        }
+
+        auto f = reduce(executor, std::move(futures), int64_t(0), [](int64_t sum, future<int> g) {
+            return sum + g.get();
+        });
+
+        for (auto& p : promises) {
+            p.set_value(1821);
+        }
+
+        benchmark::DoNotOptimize(f.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * width);
+    executor->stop();
+}
+
+BENCHMARK_TEMPLATE(BM_ReduceWidth, DefaultExecutor)
+    ->ArgsProduct({kQs, {10, 1000, 10000}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ReduceWidth, PartialSortExecutor)
+    ->ArgsProduct({kQs, {10, 1000, 10000}})
+    ->UseRealTime();
+
+//! Measures the same sum as BM_ReduceWidth, with a continuation on the result of all().
+template <class TExecutor>
+void BM_AllThenFoldWidth(benchmark::State& state)
+{
+    auto executor = make_shared<TExecutor>(microseconds(state.range(0)));
+    const auto width = state.range(1);
+
+    for (auto _ : state) {
+        vector<promise<int>> promises(width);
+
+        vector<future<int>> futures;
+        futures.reserve(width);
+        for (auto& p : promises) {
+            futures.push_back(p.get_future());
+        }
+
+        auto f = then(executor, all(executor, std::move(futures)), [](auto g) {
+            int64_t sum = 0;
+            for (auto& h : g.get()) {
+                sum += h.get();
+            }
+            return sum;
+        });
+
+        for (auto& p : promises) {
+            p.set_value(1821);
+        }
+
+        benchmark::DoNotOptimize(f.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * width);
+    executor->stop();
+}
+
+BENCHMARK_TEMPLATE(BM_AllThenFoldWidth, DefaultExecutor)
+    ->ArgsProduct({kQs, {10, 1000, 10000}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_AllThenFoldWidth, PartialSortExecutor)
+    ->ArgsProduct({kQs, {10, 1000, 10000}})
+    ->UseRealTime();
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/PollingExecutorWithPartialSort.h>
+#include <thousandeyes/futures/then.h>
+
+using std::future;
+using std::make_shared;
+using std::promise;
+using std::thread;
+using std::vector;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::PollingExecutorWithPartialSort;
+using thousandeyes::futures::then;
+using thousandeyes::futures::detail::InvokerWithNewThread;
+using thousandeyes::futures::detail::InvokerWithSingleThread;
+
+namespace {
+
+using PartialSortExecutor =
+    PollingExecutorWithPartialSort<InvokerWithNewThread, InvokerWithSingleThread>;
+
+// The polling timeouts (q), in microseconds, that every executor is measured with
+const std::vector<int64_t> kQs{100, 1000, 10000};
+
+} // namespace
+
+//! Measures the time from the moment an input future becomes ready until its
+//! continuation runs (dispatch lag), while the executor also watches the given
+//! number of futures that never become ready.
+template <class TExecutor>
+void BM_DispatchLag(benchmark::State& state)
+{
+    auto executor = make_shared<TExecutor>(microseconds(state.range(0)));
+
+    vector<promise<int>> idle(state.range(1));
+    vector<future<int>> idleResults;
+    for (auto& p : idle) {
+        idleResults.push_back(then(executor, p.get_future(), [](future<int> f) {
+            return f.get();
+        }));
+    }
+
+    nanoseconds totalLag{0};
+    for (auto _ : state) {
+        promise<steady_clock::time_point> p;
+
+        auto lag = then(executor, p.get_future(), [](future<steady_clock::time_point> f) {
+            return duration_cast<nanoseconds>(steady_clock::now() - f.get());
+        });
+
+        p.set_value(steady_clock::now());
+        totalLag += lag.get();
+    }
+
+    state.counters["lag_us"] = benchmark::Counter(
+        duration_cast<microseconds>(totalLag).count(), benchmark::Counter::kAvgIterations);
+
+    executor->stop();
+}
+
+BENCHMARK_TEMPLATE(BM_DispatchLag, DefaultExecutor)
+    ->ArgsProduct({kQs, {0, 10, 100}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_DispatchLag, PartialSortExecutor)
+    ->ArgsProduct({kQs, {0, 10, 100}})
+    ->UseRealTime();
+
+//! Measures the CPU time that the whole process spends per completed continuation,
+//! when the inputs become ready one after the other, at a steady pace, from another
+//! thread, so that the cost of polling while idle is included.
+template <class TExecutor>
+void BM_CpuPerCompletion(benchmark::State& state)
+{
+    auto executor = make_shared<TExecutor>(microseconds(state.range(0)));
+    const auto count = state.range(1);
+
+    const auto cpuStart = std::clock();
+
+    for (auto _ : state) {
+        vector<promise<int>> promises(count);
+
+        vector<future<int>> results;
+        results.reserve(count);
+        for (auto& p : promises) {
+            results.push_back(then(executor, p.get_future(), [](future<int> f) {
+                return f.get() + 1;
+            }));
+        }
+
+        thread producer([&promises]() {
+            for (auto& p : promises) {
+                std::this_thread::sleep_for(microseconds(50));
+                p.set_value(1821);
+            }
+        });
+
+        for (auto& f : results) {
+            benchmark::DoNotOptimize(f.get());
+        }
+
+        producer.join();
+    }
+
+    const auto cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    const auto completions = static_cast<double>(state.iterations() * count);
+
+    state.counters["cpu_us_per_completion"] = cpuSeconds * 1e6 / completions;
+    state.SetItemsProcessed(state.iterations() * count);
+
+    executor->stop();
+}
+
+BENCHMARK_TEMPLATE(BM_CpuPerCompletion, DefaultExecutor)
+    ->ArgsProduct({kQs, {100}})
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CpuPerCompletion, PartialSortExecutor)
+    ->ArgsProduct({kQs, {100}})
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
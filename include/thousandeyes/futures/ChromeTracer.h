@@ -0,0 +1,245 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+#include <thousandeyes/futures/detail/TraceLog.h>
+#include <thousandeyes/futures/Waitable.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief The instrumentation policy of the polling executors that records the
+//! timeline of every #Waitable in the trace-event format, which can be loaded in
+//! Perfetto (https://ui.perfetto.dev) or chrome://tracing.
+//!
+//! \par Every #Waitable gets an asynchronous slice, named after its concrete type,
+//! from the time it is watched until its dispatch finishes, with its deadline as an
+//! argument and with instant events for every time it is polled and for the time it
+//! is found ready. The sweeps of the poller over the pending #Waitable instances and
+//! the dispatches on the invoker threads are recorded as slices of those threads.
+//!
+//! \par The events are recorded, without locking, in per-thread ring buffers that
+//! keep the latest events of every thread and are shared by all the executors that
+//! use this policy. They are exported with write(), e.g.:
+//!
+//! \code
+//! using Executor = PollingExecutor<InvokerWithNewThread, InvokerWithSingleThread,
+//!                                  ChromeTracer>;
+//!
+//! auto executor = std::make_shared<Executor>(std::chrono::milliseconds(10));
+//! // ...
+//! executor->stop();
+//!
+//! std::ofstream out("trace.json");
+//! ChromeTracer::write(out);
+//! \endcode
+//!
+//! \note The ring buffers are read without synchronizing with the threads that
+//! record the events, so write() and clear() must only be called once the traced
+//! executors are idle or stopped.
+//!
+//! \sa NoInstrumentation, ExecutorStats
+class ChromeTracer {
+public:
+    //! \brief Writes the recorded events to the given stream as a JSON object in the
+    //! trace-event format, with the timestamps in us since the epoch of the steady
+    //! clock.
+    static void write(std::ostream& out)
+    {
+        std::unordered_map<const std::type_info*, std::string> names;
+
+        out << "{\"traceEvents\":[";
+
+        bool isFirst = true;
+        detail::TraceLog::forEach([&out, &names, &isFirst](const detail::TraceEvent& e) {
+            out << (isFirst ? "\n" : ",\n");
+            isFirst = false;
+
+            out << "{\"ph\":\"" << e.phase << "\",\"pid\":1,\"tid\":" << e.tid << ",\"ts\":";
+            writeMicros_(out, e.ts);
+
+            out << ",\"name\":\"";
+            if (e.name) {
+                out << e.name;
+            }
+            else {
+                writeTypeName_(out, names, e.type);
+            }
+            out << "\"";
+
+            switch (e.phase) {
+            case 'b':
+                out << ",\"cat\":\"waitable\",\"id\":\"0x" << std::hex << e.id << std::dec
+                    << "\",\"args\":{\"deadline\":";
+                writeMicros_(out, e.arg * 1000000);
+                out << "}";
+                break;
+
+            case 'n':
+            case 'e':
+                out << ",\"cat\":\"waitable\",\"id\":\"0x" << std::hex << e.id << std::dec
+                    << "\"";
+                break;
+
+            case 'B':
+                out << ",\"args\":{\"waitable\":\"";
+                writeTypeName_(out, names, e.type);
+                out << "\",\"id\":\"0x" << std::hex << e.id << std::dec << "\",\"lag\":";
+                writeMicros_(out, e.arg);
+                out << "}";
+                break;
+
+            case 'X':
+                out << ",\"dur\":";
+                writeMicros_(out, e.dur);
+                out << ",\"args\":{\"pending\":" << e.arg << "}";
+                break;
+            }
+
+            out << "}";
+        });
+
+        out << "\n]}\n";
+    }
+
+    //! \brief Discards all the recorded events.
+    static void clear()
+    {
+        detail::TraceLog::clear();
+    }
+
+    // Instrumentation policy hooks (see NoInstrumentation)
+
+    struct Mark {
+        const std::type_info* type;
+        std::uintptr_t id;
+        std::int64_t time;
+    };
+
+    Mark mark() const
+    {
+        return Mark{nullptr, 0, now_()};
+    }
+
+    void onWatch(const Waitable& w)
+    {
+        const auto deadline = w.deadline().count();
+        detail::TraceLog::record({'b', 0, nullptr, &typeid(w), id_(w), now_(), 0, deadline});
+    }
+
+    void onWait(const Waitable& w)
+    {
+        detail::TraceLog::record({'n', 0, "wait", &typeid(w), id_(w), now_(), 0, 0});
+    }
+
+    void onSweep(const Mark& start, std::size_t pending)
+    {
+        const auto now = now_();
+        detail::TraceLog::record({'X',
+                                  0,
+                                  "sweep",
+                                  nullptr,
+                                  0,
+                                  start.time,
+                                  now - start.time,
+                                  static_cast<std::int64_t>(pending)});
+    }
+
+    Mark onReady(const Waitable& w)
+    {
+        Mark ready{&typeid(w), id_(w), now_()};
+        detail::TraceLog::record({'n', 0, "ready", ready.type, ready.id, ready.time, 0, 0});
+        return ready;
+    }
+
+    static void onDispatch(const Mark& ready)
+    {
+        const auto now = now_();
+        detail::TraceLog::record(
+            {'B', 0, "dispatch", ready.type, ready.id, now, 0, now - ready.time});
+    }
+
+    static void onFinish(const Mark& ready)
+    {
+        const auto now = now_();
+        detail::TraceLog::record({'E', 0, "dispatch", ready.type, ready.id, now, 0, 0});
+        detail::TraceLog::record({'e', 0, nullptr, ready.type, ready.id, now, 0, 0});
+    }
+
+private:
+    static std::int64_t now_()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    static std::uintptr_t id_(const Waitable& w)
+    {
+        return reinterpret_cast<std::uintptr_t>(&w);
+    }
+
+    static void writeMicros_(std::ostream& out, std::int64_t ns)
+    {
+        if (ns < 0) {
+            out << '-';
+            ns = -ns;
+        }
+
+        const auto fraction = ns % 1000;
+        out << ns / 1000 << '.' << fraction / 100 << fraction / 10 % 10 << fraction % 10;
+    }
+
+    static void writeTypeName_(std::ostream& out,
+                               std::unordered_map<const std::type_info*, std::string>& names,
+                               const std::type_info* type)
+    {
+        auto it = names.find(type);
+        if (it == names.end()) {
+            it = names.emplace(type, demangle_(*type)).first;
+        }
+
+        for (char c : it->second) {
+            if (c == '"' || c == '\\') {
+                out << '\\';
+            }
+            out << c;
+        }
+    }
+
+    static std::string demangle_(const std::type_info& type)
+    {
+#if defined(__GNUG__)
+        int status = 0;
+        char* name = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+        if (status == 0 && name) {
+            std::string result(name);
+            std::free(name);
+            return result;
+        }
+#endif
+        return type.name();
+    }
+};
+
+} // namespace futures
+} // namespace thousandeyes
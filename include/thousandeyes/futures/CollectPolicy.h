@@ -0,0 +1,25 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief What collect() does with the input futures that hold an exception.
+enum class CollectPolicy {
+    //! \brief The resulting future holds the exception of the first failed input
+    //! future, in the order of the inputs.
+    RethrowFirst,
+
+    //! \brief The values of the failed input futures are left out of the result.
+    SkipFailed,
+};
+
+} // namespace futures
+} // namespace thousandeyes
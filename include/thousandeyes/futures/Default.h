@@ -10,8 +10,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 namespace thousandeyes {
 namespace futures {
@@ -19,23 +22,44 @@ namespace futures {
 //! \brief Component for setting default shared pointer instances that have
 //! a well-defined lifetime.
 //!
+//! \par A Default<>::ThreadSetter sets the default instance of the current thread
+//! only, which takes precedence over the one set via a Default<>::Setter.
+//!
+//! \par Obtaining the default instance does not take any lock, unless a Setter has
+//! changed it since the last time the current thread obtained it: every thread
+//! caches a reference to the default instance, along with the version of the
+//! default instance, which every Setter increments.
+//!
 //! \note The lifetime of default instances is determined by the lifetime of
 //! the respective Default<>::Setter instances that are meant to be allocated
-//! on the stack.
+//! on the stack. However, since the cached references are strong, a thread that
+//! obtained the default instance keeps it alive after the Setter that set it is
+//! destroyed, until the thread obtains the default instance again or exits; the
+//! thread that destroys the Setter releases its own cached reference right away.
 template <class T>
 class Default {
 public:
     struct Setter {
         Setter(std::shared_ptr<T> instance) : prevInstance_(std::move(instance))
         {
+            // The stale cache is released after the lock, in case it was the last
+            // reference to the previous default instance
+            Cache stale;
+
             std::lock_guard<std::mutex> lock(mutex_);
             defaultInstance_.swap(prevInstance_);
+            version_.fetch_add(1, std::memory_order_release);
+            std::swap(stale, cache_);
         }
 
         ~Setter()
         {
+            Cache stale;
+
             std::lock_guard<std::mutex> lock(mutex_);
             defaultInstance_.swap(prevInstance_);
+            version_.fetch_add(1, std::memory_order_release);
+            std::swap(stale, cache_);
         }
 
         Setter(const Setter&) = delete;
@@ -47,19 +71,67 @@ public:
         std::shared_ptr<T> prevInstance_;
     };
 
+    //! \brief Sets the default instance of the current thread, for as long as
+    //! it is in scope, without affecting the other threads.
+    //!
+    //! \note A ThreadSetter must be destroyed on the thread that created it.
+    struct ThreadSetter {
+        ThreadSetter(std::shared_ptr<T> instance) : prevInstance_(std::move(instance))
+        {
+            threadInstance_.swap(prevInstance_);
+        }
+
+        ~ThreadSetter()
+        {
+            threadInstance_.swap(prevInstance_);
+        }
+
+        ThreadSetter(const ThreadSetter&) = delete;
+        ThreadSetter(ThreadSetter&&) = delete;
+        ThreadSetter& operator=(const ThreadSetter&) = delete;
+        ThreadSetter& operator=(ThreadSetter&&) = delete;
+
+    private:
+        std::shared_ptr<T> prevInstance_;
+    };
+
     //! \brief Obtains the current default shared pointer instance that was
-    //! previously set via the instantiation of a Default<>::Setter.
+    //! previously set via the instantiation of a Default<>::ThreadSetter on the
+    //! current thread or, otherwise, of a Default<>::Setter.
     //!
     //! \return The current default shared pointer instance.
     operator std::shared_ptr<T>() const
     {
+        if (threadInstance_) {
+            return threadInstance_;
+        }
+
+        // The cached reference is the default instance as long as the version has
+        // not changed; copying it is a single atomic increment, unlike locking a
+        // weak reference, which is a compare-and-swap loop
+        if (cache_.version == version_.load(std::memory_order_acquire)) {
+            return cache_.instance;
+        }
+
         std::lock_guard<std::mutex> lock(mutex_);
-        return defaultInstance_;
+
+        cache_.version = version_.load(std::memory_order_relaxed);
+        cache_.instance = defaultInstance_;
+        return cache_.instance;
     }
 
 private:
+    struct Cache {
+        std::uint64_t version{0};
+        std::shared_ptr<T> instance;
+    };
+
     static std::mutex mutex_;
     static std::shared_ptr<T> defaultInstance_;
+    static std::atomic<std::uint64_t> version_;
+
+    static thread_local std::shared_ptr<T> threadInstance_;
+    static thread_local Cache cache_;
 };
 
 template <class T>
@@ -68,5 +140,15 @@ std::mutex Default<T>::mutex_;
 template <class T>
 std::shared_ptr<T> Default<T>::defaultInstance_;
 
+// Starts past the version of the empty cache, so that the first lookup fills it
+template <class T>
+std::atomic<std::uint64_t> Default<T>::version_{1};
+
+template <class T>
+thread_local std::shared_ptr<T> Default<T>::threadInstance_;
+
+template <class T>
+thread_local typename Default<T>::Cache Default<T>::cache_;
+
 } // namespace futures
 } // namespace thousandeyes
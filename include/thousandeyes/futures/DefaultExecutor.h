@@ -16,14 +16,21 @@
 #include <thread>
 
 #include <thousandeyes/futures/detail/InvokerWithNewThread.h>
+#include <thousandeyes/futures/detail/InvokerWithPersistentThread.h>
 #include <thousandeyes/futures/detail/InvokerWithSingleThread.h>
+#include <thousandeyes/futures/detail/InvokerWithThreadPool.h>
 #include <thousandeyes/futures/PollingExecutor.h>
 
 namespace thousandeyes {
 namespace futures {
 
 using DefaultExecutor =
-    PollingExecutor<detail::InvokerWithNewThread, detail::InvokerWithSingleThread>;
+    PollingExecutor<detail::InvokerWithPersistentThread, detail::InvokerWithSingleThread>;
+
+//! \brief A #PollingExecutor that dispatches the ready #Waitable instances on a pool
+//! of threads, so that a slow continuation does not stall the rest.
+using ThreadPoolExecutor =
+    PollingExecutor<detail::InvokerWithPersistentThread, detail::InvokerWithThreadPool>;
 
 } // namespace futures
 } // namespace thousandeyes
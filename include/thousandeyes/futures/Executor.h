@@ -11,6 +11,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 
 namespace thousandeyes {
 namespace futures {
@@ -35,6 +36,17 @@ public:
     //! when it throws.
     virtual void watch(std::unique_ptr<Waitable> w) = 0;
 
+    //! \brief Executes the given #Waitable, which is already known to be ready.
+    //!
+    //! \param w The ready #Waitable instance to dispatch.
+    //!
+    //! \note The default implementation watches the #Waitable as usual; executors
+    //! can override it to dispatch the #Waitable without checking its readiness.
+    virtual void ready(std::unique_ptr<Waitable> w)
+    {
+        watch(std::move(w));
+    }
+
     //! \brief Stops the executor and tries to cancel all pending operations.
     virtual void stop() = 0;
 };
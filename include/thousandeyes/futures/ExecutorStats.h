@@ -0,0 +1,228 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <thousandeyes/futures/Waitable.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief A lock-free histogram of latencies with power-of-two buckets.
+//!
+//! \par Bucket 0 counts the latencies below 1us and bucket i, for i > 0, counts the
+//! latencies in [2^(i-1), 2^i) us; the last bucket also counts all the larger ones.
+class LatencyHistogram {
+public:
+    static constexpr std::size_t kBuckets = 32;
+
+    //! \brief A consistent-enough copy of the histogram's values.
+    struct Snapshot {
+        std::array<std::uint64_t, kBuckets> buckets{};
+        std::uint64_t count{0};
+        std::chrono::nanoseconds total{0};
+        std::chrono::nanoseconds max{0};
+
+        //! \brief The average of the recorded latencies.
+        std::chrono::nanoseconds mean() const
+        {
+            if (count == 0) {
+                return std::chrono::nanoseconds(0);
+            }
+            return total / static_cast<std::int64_t>(count);
+        }
+
+        //! \brief The upper bound of the bucket that contains the given percentile
+        //! (in [0, 100]) of the recorded latencies.
+        std::chrono::microseconds percentile(double p) const
+        {
+            const auto rank = static_cast<std::uint64_t>(p / 100.0 * count);
+
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < kBuckets; ++i) {
+                seen += buckets[i];
+                if (seen > rank || seen == count) {
+                    return std::chrono::microseconds(std::uint64_t(1) << i);
+                }
+            }
+            return std::chrono::microseconds(std::uint64_t(1) << (kBuckets - 1));
+        }
+    };
+
+    void record(std::chrono::nanoseconds latency)
+    {
+        const auto ns = latency.count() < 0 ? 0 : static_cast<std::uint64_t>(latency.count());
+
+        std::size_t i = 0;
+        for (auto us = ns / 1000; us != 0 && i + 1 < kBuckets; us >>= 1) {
+            ++i;
+        }
+
+        buckets_[i].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        total_.fetch_add(ns, std::memory_order_relaxed);
+
+        auto max = max_.load(std::memory_order_relaxed);
+        while (max < ns && !max_.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {
+        }
+    }
+
+    Snapshot snapshot() const
+    {
+        Snapshot s;
+        for (std::size_t i = 0; i < kBuckets; ++i) {
+            s.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+        }
+        s.count = count_.load(std::memory_order_relaxed);
+        s.total = std::chrono::nanoseconds(total_.load(std::memory_order_relaxed));
+        s.max = std::chrono::nanoseconds(max_.load(std::memory_order_relaxed));
+        return s;
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, kBuckets> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> total_{0};
+    std::atomic<std::uint64_t> max_{0};
+};
+
+namespace detail {
+
+struct ExecutorStatsState {
+    std::atomic<std::uint64_t> watches{0};
+    std::atomic<std::uint64_t> sweeps{0};
+    std::atomic<std::uint64_t> waits{0};
+    std::atomic<std::uint64_t> dispatches{0};
+    std::atomic<std::size_t> pending{0};
+    LatencyHistogram sweepDuration;
+    LatencyHistogram readyToDispatch;
+};
+
+} // namespace detail
+
+//! \brief The instrumentation policy of the polling executors that collects their
+//! metrics with atomic counters and latency histograms.
+//!
+//! \par The metrics are the number of watched #Waitable instances (whose rate is
+//! the difference between two snapshots over the time between them), the number of
+//! pending #Waitable instances after the last sweep, the duration of every sweep, the
+//! number of Waitable::wait() calls per dispatch and the latency from ready to
+//! dispatch (readyToDispatch).
+//!
+//! \par The readyToDispatch latency starts when the executor hands a ready #Waitable
+//! to the dispatch functor, i.e., when a sweep finds it ready or when it is pushed via
+//! Executor::ready(), and ends when its dispatch starts, so it measures the time it
+//! spends queued in the dispatch functor. It does not include the time between the
+//! #Waitable becoming ready and the sweep that finds it, which depends on the polling
+//! period and on the duration of the sweeps.
+//!
+//! \par Copies of an ExecutorStats object share the same metrics, so they can be
+//! read, via snapshot(), after the executor is destroyed. E.g.:
+//!
+//! \code
+//! using Executor = PollingExecutor<InvokerWithNewThread, InvokerWithSingleThread,
+//!                                  ExecutorStats>;
+//!
+//! auto executor = std::make_shared<Executor>(std::chrono::milliseconds(10));
+//! ExecutorStats stats = executor->instrumentation();
+//! \endcode
+//!
+//! \sa NoInstrumentation
+class ExecutorStats {
+public:
+    //! \brief A copy of the executor's metrics.
+    struct Snapshot {
+        std::uint64_t watches{0};
+        std::uint64_t sweeps{0};
+        std::uint64_t waits{0};
+        std::uint64_t dispatches{0};
+        std::size_t pending{0};
+        LatencyHistogram::Snapshot sweepDuration;
+        //! \brief The latency from handing a ready #Waitable to the dispatch functor
+        //! to the start of its dispatch.
+        LatencyHistogram::Snapshot readyToDispatch;
+
+        //! \brief The average number of Waitable::wait() calls per dispatch.
+        double waitsPerDispatch() const
+        {
+            return dispatches == 0 ? 0.0 : static_cast<double>(waits) / dispatches;
+        }
+    };
+
+    ExecutorStats() : state_(std::make_shared<detail::ExecutorStatsState>())
+    {}
+
+    Snapshot snapshot() const
+    {
+        Snapshot s;
+        s.watches = state_->watches.load(std::memory_order_relaxed);
+        s.sweeps = state_->sweeps.load(std::memory_order_relaxed);
+        s.waits = state_->waits.load(std::memory_order_relaxed);
+        s.dispatches = state_->dispatches.load(std::memory_order_relaxed);
+        s.pending = state_->pending.load(std::memory_order_relaxed);
+        s.sweepDuration = state_->sweepDuration.snapshot();
+        s.readyToDispatch = state_->readyToDispatch.snapshot();
+        return s;
+    }
+
+    // Instrumentation policy hooks (see NoInstrumentation)
+
+    struct Mark {
+        std::shared_ptr<detail::ExecutorStatsState> state;
+        std::chrono::steady_clock::time_point time;
+    };
+
+    Mark mark() const
+    {
+        return Mark{state_, std::chrono::steady_clock::now()};
+    }
+
+    void onWatch(const Waitable& /* w */)
+    {
+        state_->watches.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void onWait(const Waitable& /* w */)
+    {
+        state_->waits.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void onSweep(const Mark& start, std::size_t pending)
+    {
+        state_->sweeps.fetch_add(1, std::memory_order_relaxed);
+        state_->pending.store(pending, std::memory_order_relaxed);
+        state_->sweepDuration.record(std::chrono::steady_clock::now() - start.time);
+    }
+
+    Mark onReady(const Waitable& /* w */)
+    {
+        return mark();
+    }
+
+    static void onDispatch(const Mark& ready)
+    {
+        ready.state->dispatches.fetch_add(1, std::memory_order_relaxed);
+        ready.state->readyToDispatch.record(std::chrono::steady_clock::now() - ready.time);
+    }
+
+    static void onFinish(const Mark& /* ready */)
+    {}
+
+private:
+    std::shared_ptr<detail::ExecutorStatsState> state_;
+};
+
+} // namespace futures
+} // namespace thousandeyes
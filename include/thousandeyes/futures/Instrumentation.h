@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <thousandeyes/futures/Waitable.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief The instrumentation policy of the polling executors that does not collect
+//! anything, so that it costs nothing.
+//!
+//! \par An instrumentation policy is default-constructible and provides the
+//! following hooks, which the executors invoke from multiple threads:
+//! - `Mark mark()`, which captures the start of a sweep, where Mark is a copyable
+//!   type that must remain usable after the executor is destroyed;
+//! - `void onWatch(const Waitable& w)`, when a #Waitable is handed to the executor,
+//!   either to be watched or because it is already ready (see Executor::ready());
+//! - `void onWait(const Waitable& w)`, when the executor calls Waitable::wait();
+//! - `void onSweep(const Mark& start, std::size_t pending)`, when the executor
+//!   finishes polling all its pending #Waitable instances once;
+//! - `Mark onReady(const Waitable& w)`, when a #Waitable is handed to the dispatch
+//!   functor, because it was found ready or it has to be cancelled;
+//! - `static void onDispatch(const Mark& ready)` and
+//!   `static void onFinish(const Mark& ready)`, right before and right after the
+//!   #Waitable is dispatched, on the thread that dispatches it.
+//!
+//! \sa ExecutorStats, ChromeTracer
+class NoInstrumentation {
+public:
+    struct Mark {};
+
+    Mark mark() const
+    {
+        return {};
+    }
+
+    void onWatch(const Waitable& /* w */)
+    {}
+
+    void onWait(const Waitable& /* w */)
+    {}
+
+    void onSweep(const Mark& /* start */, std::size_t /* pending */)
+    {}
+
+    Mark onReady(const Waitable& /* w */)
+    {
+        return {};
+    }
+
+    static void onDispatch(const Mark& /* ready */)
+    {}
+
+    static void onFinish(const Mark& /* ready */)
+    {}
+};
+
+} // namespace futures
+} // namespace thousandeyes
@@ -10,34 +10,71 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <string>
+#include <type_traits>
 
+#include <thousandeyes/futures/detail/MpscQueue.h>
+#include <thousandeyes/futures/detail/PendingWaitable.h>
+#include <thousandeyes/futures/detail/Task.h>
+#include <thousandeyes/futures/detail/TimerWheel.h>
 #include <thousandeyes/futures/Executor.h>
+#include <thousandeyes/futures/Instrumentation.h>
+#include <thousandeyes/futures/PollingOptions.h>
+#include <thousandeyes/futures/TimedWaitable.h>
 #include <thousandeyes/futures/Waitable.h>
 
 namespace thousandeyes {
 namespace futures {
 
 //! \brief An implementation of the #Executor that polls to determine when the
-//! "watched" #Waitable instances become ready.
+//! "watched" #Waitable instances become ready. The pending #Waitable instances are
+//! kept ordered by their deadline, so that the ones whose deadline has been exceeded
+//! are checked once more, without blocking, and then cancelled with a
+//! #WaitableTimedOutException instead of being polled again.
+//!
+//! \par By default, the PollingExecutor waits up to the polling timeout on every
+//! pending #Waitable (see PollingMode::Blocking). With PollingMode::Sweep, it checks
+//! all of them without blocking and sleeps only when none was ready, so that a
+//! single slow #Waitable does not delay the rest; watching a new #Waitable wakes the
+//! sleeping poller up.
+//!
+//! \par New #Waitable instances are submitted through a lock-free queue that the
+//! poller drains in bulk, so that watch() does not contend on a lock with the
+//! poller or with other producers.
+//!
+//! \par Unless the ReadyPolicy is ReadyPolicy::Poll (the default), watch() checks
+//! every new #Waitable once, without blocking, and the ready ones bypass the queue:
+//! they are either handed to the dispatch functor or dispatched inline.
+//!
+//! \par With a PollingBackoff, the #Waitable instances that have been pending for
+//! long are polled geometrically less often than the new ones (see
+//! PollingOptions::backoff).
+//!
+//! \par The TInstrumentation policy collects the executor's metrics (see
+//! ExecutorStats); the default, NoInstrumentation, compiles all its hooks away.
 //!
 //! \note The PollingExecutor dispatches the polling function via the TPollFunctor
 //! functor and, subsequently, dispatches a ready #Waitable via the TDispatchFunctor
 //! functor.
-template <class TPollFunctor, class TDispatchFunctor>
+template <class TPollFunctor, class TDispatchFunctor, class TInstrumentation = NoInstrumentation>
 class PollingExecutor :
     public Executor,
-    public std::enable_shared_from_this<PollingExecutor<TPollFunctor, TDispatchFunctor>> {
+    public std::enable_shared_from_this<
+        PollingExecutor<TPollFunctor, TDispatchFunctor, TInstrumentation>> {
 public:
     //! \brief Constructs a #PollingExecutor with default-constructed functors
     //! for polling and dispatching ready #Waitables
     //!
     //! \param q The polling timeout.
-    PollingExecutor(std::chrono::microseconds q) :
+    //! \param options The options that tune the polling.
+    PollingExecutor(std::chrono::microseconds q, PollingOptions options = {}) :
         q_(std::move(q)),
+        options_(std::move(options)),
         pollFunc_(std::make_unique<TPollFunctor>()),
         dispatchFunc_(std::make_unique<TDispatchFunctor>())
     {}
@@ -48,10 +85,13 @@ public:
     //! \param q The polling timeout.
     //! \param pollFunc The functor used to dispatch the polling function.
     //! \param dispatchFunc The functor used to dispatch the ready #Waitables.
+    //! \param options The options that tune the polling.
     PollingExecutor(std::chrono::microseconds q,
                     TPollFunctor&& pollFunc,
-                    TDispatchFunctor&& dispatchFunc) :
+                    TDispatchFunctor&& dispatchFunc,
+                    PollingOptions options = {}) :
         q_(std::move(q)),
+        options_(std::move(options)),
         pollFunc_(std::make_unique<TPollFunctor>(std::forward<TPollFunctor>(pollFunc))),
         dispatchFunc_(
             std::make_unique<TDispatchFunctor>(std::forward<TDispatchFunctor>(dispatchFunc)))
@@ -70,83 +110,128 @@ public:
 
     void watch(std::unique_ptr<Waitable> w) override final
     {
-        bool isActive;
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
+        instrumentation_.onWatch(*w);
 
-            isActive = active_;
+        if (!active_.load()) {
+            cancel_(std::move(w), "Executor inactive");
+            return;
+        }
 
-            if (isActive) {
-                waitables_.push(std::move(w));
+        if (options_.readyPolicy != ReadyPolicy::Poll && dispatchIfReady_(w)) {
+            return;
+        }
 
-                if (isPollerRunning_) {
-                    return;
-                }
+        waitables_.push(std::move(w));
 
-                isPollerRunning_ = true;
-            }
+        if (!active_.load()) {
+            // Raced with stop(), which may have drained the queue before the push
+            cancelAll_("Executor inactive");
+            return;
         }
 
-        if (!isActive) {
-            cancel_(std::move(w), "Executor inactive");
+        if (!isPollerRunning_.exchange(true)) {
+            start_();
             return;
         }
 
-        (*pollFunc_)([this, keep = this->shared_from_this()]() {
-            while (true) {
-                std::unique_ptr<Waitable> w;
-                {
-                    std::lock_guard<std::mutex> lock(mutex_);
-
-                    if (waitables_.empty() || !active_) {
-                        isPollerRunning_ = false;
-                        break;
-                    }
+        if (isPollerSleeping_.load()) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            sleepCond_.notify_one();
+        }
+    }
 
-                    w = std::move(waitables_.front());
-                    waitables_.pop();
-                }
+    void ready(std::unique_ptr<Waitable> w) override final
+    {
+        instrumentation_.onWatch(*w);
 
-                try {
-                    if (!w->wait(q_)) {
-                        std::lock_guard<std::mutex> lock(mutex_);
-                        waitables_.push(std::move(w));
-                        continue;
-                    }
+        if (!active_.load()) {
+            cancel_(std::move(w), "Executor inactive");
+            return;
+        }
 
-                    dispatch_(std::move(w), nullptr);
-                }
-                catch (...) {
-                    dispatch_(std::move(w), std::current_exception());
-                }
-            }
-        });
+        dispatch_(std::move(w), nullptr);
     }
 
     void stop() override final
     {
-        std::queue<std::unique_ptr<Waitable>> pending;
         {
             std::lock_guard<std::mutex> lock(mutex_);
 
-            active_ = false;
-            pending.swap(waitables_);
+            active_.store(false);
+            sleepCond_.notify_one();
         }
 
-        while (!pending.empty()) {
-            cancel_(std::move(pending.front()), "Executor stoped");
-            pending.pop();
-        }
+        cancelAll_("Executor stoped");
+    }
+
+    //! \brief The policy object that collects the executor's metrics.
+    const TInstrumentation& instrumentation() const
+    {
+        return instrumentation_;
     }
 
 private:
     inline void dispatch_(std::unique_ptr<Waitable> w, std::exception_ptr error)
     {
+        dispatch_(std::move(w), std::move(error), detail::accepts_task<TDispatchFunctor>{});
+    }
+
+    inline void dispatch_(std::unique_ptr<Waitable> w,
+                          std::exception_ptr error,
+                          std::true_type /* acceptsTask */)
+    {
+        auto ready = instrumentation_.onReady(*w);
+
+        // Without instrumentation, the lambda fits in the Task's small buffer, so
+        // dispatching does not allocate
+        (*dispatchFunc_)(detail::Task(
+            [w = std::move(w), error = std::move(error), ready = std::move(ready)]() {
+                TInstrumentation::onDispatch(ready);
+                w->dispatch(error);
+                TInstrumentation::onFinish(ready);
+            }));
+    }
+
+    inline void dispatch_(std::unique_ptr<Waitable> w,
+                          std::exception_ptr error,
+                          std::false_type /* acceptsTask */)
+    {
+        auto ready = instrumentation_.onReady(*w);
+
         // Using shared_ptr to enable copy-ability of the lambda, otherwise the
         // dispatchFunc_ would not be able to accept it as function<void()>
         std::shared_ptr<Waitable> wShared = std::move(w);
         (*dispatchFunc_)(
-            [w = std::move(wShared), error = std::move(error)]() { w->dispatch(error); });
+            [w = std::move(wShared), error = std::move(error), ready = std::move(ready)]() {
+                TInstrumentation::onDispatch(ready);
+                w->dispatch(error);
+                TInstrumentation::onFinish(ready);
+            });
+    }
+
+    inline bool dispatchIfReady_(std::unique_ptr<Waitable>& w)
+    {
+        std::exception_ptr error;
+        try {
+            instrumentation_.onWait(*w);
+            if (!w->wait(std::chrono::microseconds(0))) {
+                return false;
+            }
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        if (options_.readyPolicy == ReadyPolicy::Inline) {
+            auto ready = instrumentation_.onReady(*w);
+            TInstrumentation::onDispatch(ready);
+            w->dispatch(std::move(error));
+            TInstrumentation::onFinish(ready);
+        }
+        else {
+            dispatch_(std::move(w), std::move(error));
+        }
+        return true;
     }
 
     inline void cancel_(std::unique_ptr<Waitable> w, const std::string& message)
@@ -155,12 +240,158 @@ private:
         dispatch_(std::move(w), std::move(error));
     }
 
+    inline void start_()
+    {
+        (*pollFunc_)([this, keep = this->shared_from_this()]() { poll_(); });
+    }
+
+    inline void cancelAll_(const std::string& message)
+    {
+        waitables_.drain(
+            [this, &message](std::unique_ptr<Waitable> w) { cancel_(std::move(w), message); });
+    }
+
+    inline void expire_(std::unique_ptr<Waitable> w)
+    {
+        // Like TimedWaitable::wait(), give the expired waitable a last, non-blocking
+        // chance to turn out ready before timing it out
+        std::exception_ptr error;
+        try {
+            instrumentation_.onWait(*w);
+            if (!w->wait(std::chrono::microseconds(0))) {
+                error = std::make_exception_ptr(WaitableTimedOutException("Wait limit exceeded"));
+            }
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        dispatch_(std::move(w), std::move(error));
+    }
+
+    inline void poll_()
+    {
+        // The pending waitables are owned by the poller and ordered by their deadline,
+        // so that the expired ones get cancelled without being polled.
+        detail::TimerWheel<detail::PendingWaitable> pending(
+            toEpochTimestamp(std::chrono::steady_clock::now()));
+
+        while (true) {
+            const auto now = std::chrono::steady_clock::now();
+
+            waitables_.drain([&pending, &now](std::unique_ptr<Waitable> w) {
+                auto deadline = w->deadline();
+                pending.insert(deadline, detail::PendingWaitable(std::move(w), now));
+            });
+
+            if (!active_.load()) {
+                pending.clear([this](detail::PendingWaitable p) {
+                    cancel_(std::move(p.w), "Executor stoped");
+                });
+                cancelAll_("Executor stoped");
+
+                isPollerRunning_.store(false);
+                return;
+            }
+
+            if (pending.empty()) {
+                isPollerRunning_.store(false);
+
+                // A waitable pushed after the queue was drained, but before the flag
+                // was cleared, did not start a new poller; keep polling for it.
+                if (waitables_.empty() || isPollerRunning_.exchange(true)) {
+                    return;
+                }
+                continue;
+            }
+
+            pending.advance(toEpochTimestamp(now), [this](detail::PendingWaitable p) {
+                expire_(std::move(p.w));
+            });
+
+            auto sweepStart = instrumentation_.mark();
+
+            if (options_.mode == PollingMode::Sweep) {
+                const auto sweep = pollPending_(pending, std::chrono::microseconds(0), now);
+                instrumentation_.onSweep(sweepStart, pending.size());
+
+                if (!sweep.isAnyReady && !pending.empty()) {
+                    sleep_();
+                }
+            }
+            else {
+                const auto sweep = pollPending_(pending, q_, now);
+                instrumentation_.onSweep(sweepStart, pending.size());
+
+                // Every pending waitable is backing off, so nothing blocked this sweep
+                if (!sweep.isAnyPolled && !pending.empty()) {
+                    sleep_();
+                }
+            }
+        }
+    }
+
+    struct SweepResult {
+        bool isAnyPolled{false};
+        bool isAnyReady{false};
+    };
+
+    inline SweepResult pollPending_(detail::TimerWheel<detail::PendingWaitable>& pending,
+                                    const std::chrono::microseconds& q,
+                                    std::chrono::steady_clock::time_point now)
+    {
+        SweepResult result;
+
+        pending.removeIf([this, &q, &now, &result](detail::PendingWaitable& p) {
+            if (!p.isDue(now)) {
+                return false;
+            }
+
+            result.isAnyPolled = true;
+
+            try {
+                instrumentation_.onWait(*p.w);
+                if (!p.w->wait(q)) {
+                    p.backOff(options_.backoff, now);
+                    return false;
+                }
+
+                dispatch_(std::move(p.w), nullptr);
+            }
+            catch (...) {
+                dispatch_(std::move(p.w), std::current_exception());
+            }
+
+            result.isAnyReady = true;
+            return true;
+        });
+
+        return result;
+    }
+
+    inline void sleep_()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        isPollerSleeping_.store(true);
+        sleepCond_.wait_for(
+            lock, q_, [this]() { return !active_.load() || !waitables_.empty(); });
+        isPollerSleeping_.store(false);
+    }
+
     const std::chrono::microseconds q_;
+    const PollingOptions options_;
+
+    detail::MpscQueue<std::unique_ptr<Waitable>> waitables_;
+    std::atomic<bool> active_{true};
+    std::atomic<bool> isPollerRunning_{false};
+    std::atomic<bool> isPollerSleeping_{false};
 
+    // Only guards the poller's sleep against the wakeups from watch() and stop()
     std::mutex mutex_;
-    std::queue<std::unique_ptr<Waitable>> waitables_;
-    bool active_{true};
-    bool isPollerRunning_{false};
+    std::condition_variable sleepCond_;
+
+    TInstrumentation instrumentation_;
 
     std::unique_ptr<TPollFunctor> pollFunc_;
     std::unique_ptr<TDispatchFunctor> dispatchFunc_;
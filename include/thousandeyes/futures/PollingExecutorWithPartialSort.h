@@ -12,13 +12,18 @@
 
 #include <algorithm>
 #include <chrono>
-#include <functional>
+#include <condition_variable>
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <vector>
 
+#include <thousandeyes/futures/detail/PendingWaitable.h>
+#include <thousandeyes/futures/detail/Task.h>
 #include <thousandeyes/futures/Executor.h>
+#include <thousandeyes/futures/Instrumentation.h>
+#include <thousandeyes/futures/PollingOptions.h>
 #include <thousandeyes/futures/Waitable.h>
 
 namespace thousandeyes {
@@ -28,21 +33,31 @@ namespace futures {
 //! "watched" #Waitable instances become ready. This particular polling executor
 //! also partially sorts the waitables left and right of their deadline median value.
 //!
+//! \par With a PollingBackoff, the #Waitable instances that have been pending for
+//! long are polled geometrically less often than the new ones, but never later than
+//! their deadline. While all of them are backing off, the poller sleeps until either
+//! the polling timeout elapses or a new #Waitable is watched.
+//!
+//! \par The TInstrumentation policy collects the executor's metrics (see
+//! ExecutorStats); the default, NoInstrumentation, compiles all its hooks away.
+//!
 //! \note The PollingExecutorWithPartialSort dispatches the polling function via the TPollFunctor
 //! functor and, subsequently, dispatches a ready #Waitable via the TDispatchFunctor
 //! functor.
-template <class TPollFunctor, class TDispatchFunctor>
+template <class TPollFunctor, class TDispatchFunctor, class TInstrumentation = NoInstrumentation>
 class PollingExecutorWithPartialSort :
     public Executor,
     public std::enable_shared_from_this<
-        PollingExecutorWithPartialSort<TPollFunctor, TDispatchFunctor>> {
+        PollingExecutorWithPartialSort<TPollFunctor, TDispatchFunctor, TInstrumentation>> {
 public:
     //! \brief Constructs a #PollingExecutorWithPartialSort with default-constructed functors
     //! for polling and dispatching ready #Waitables
     //!
     //! \param q The polling timeout.
-    PollingExecutorWithPartialSort(std::chrono::microseconds q) :
+    //! \param backoff How to poll the #Waitables that have been pending for long.
+    PollingExecutorWithPartialSort(std::chrono::microseconds q, PollingBackoff backoff = {}) :
         q_(std::move(q)),
+        backoff_(std::move(backoff)),
         pollFunc_(std::make_unique<TPollFunctor>()),
         dispatchFunc_(std::make_unique<TDispatchFunctor>())
     {}
@@ -53,10 +68,13 @@ public:
     //! \param q The polling timeout.
     //! \param pollFunc The functor used to dispatch the polling function.
     //! \param dispatchFunc The functor used to dispatch the ready #Waitables.
+    //! \param backoff How to poll the #Waitables that have been pending for long.
     PollingExecutorWithPartialSort(std::chrono::microseconds q,
                                    TPollFunctor&& pollFunc,
-                                   TDispatchFunctor&& dispatchFunc) :
+                                   TDispatchFunctor&& dispatchFunc,
+                                   PollingBackoff backoff = {}) :
         q_(std::move(q)),
+        backoff_(std::move(backoff)),
         pollFunc_(std::make_unique<TPollFunctor>(std::forward<TPollFunctor>(pollFunc))),
         dispatchFunc_(
             std::make_unique<TDispatchFunctor>(std::forward<TDispatchFunctor>(dispatchFunc)))
@@ -75,6 +93,8 @@ public:
 
     void watch(std::unique_ptr<Waitable> w) override final
     {
+        instrumentation_.onWatch(*w);
+
         bool isActive;
         {
             std::lock_guard<std::mutex> lock(mutex_);
@@ -85,6 +105,9 @@ public:
                 waitables_.push_back(std::move(w));
 
                 if (isPollerRunning_) {
+                    if (isPollerSleeping_) {
+                        sleepCond_.notify_one();
+                    }
                     return;
                 }
 
@@ -100,6 +123,24 @@ public:
         (*pollFunc_)([this, keep = this->shared_from_this()]() { poll_(); });
     }
 
+    void ready(std::unique_ptr<Waitable> w) override final
+    {
+        instrumentation_.onWatch(*w);
+
+        bool isActive;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            isActive = active_;
+        }
+
+        if (!isActive) {
+            cancel_(std::move(w), "Executor inactive");
+            return;
+        }
+
+        dispatch_(std::move(w), nullptr);
+    }
+
     void stop() override final
     {
         std::vector<std::unique_ptr<Waitable>> pending;
@@ -108,6 +149,8 @@ public:
 
             active_ = false;
             pending.swap(waitables_);
+
+            sleepCond_.notify_one();
         }
 
         for (std::unique_ptr<Waitable>& w : pending) {
@@ -115,14 +158,49 @@ public:
         }
     }
 
+    //! \brief The policy object that collects the executor's metrics.
+    const TInstrumentation& instrumentation() const
+    {
+        return instrumentation_;
+    }
+
 private:
     inline void dispatch_(std::unique_ptr<Waitable> w, std::exception_ptr error)
     {
+        dispatch_(std::move(w), std::move(error), detail::accepts_task<TDispatchFunctor>{});
+    }
+
+    inline void dispatch_(std::unique_ptr<Waitable> w,
+                          std::exception_ptr error,
+                          std::true_type /* acceptsTask */)
+    {
+        auto ready = instrumentation_.onReady(*w);
+
+        // Without instrumentation, the lambda fits in the Task's small buffer, so
+        // dispatching does not allocate
+        (*dispatchFunc_)(detail::Task(
+            [w = std::move(w), error = std::move(error), ready = std::move(ready)]() {
+                TInstrumentation::onDispatch(ready);
+                w->dispatch(error);
+                TInstrumentation::onFinish(ready);
+            }));
+    }
+
+    inline void dispatch_(std::unique_ptr<Waitable> w,
+                          std::exception_ptr error,
+                          std::false_type /* acceptsTask */)
+    {
+        auto ready = instrumentation_.onReady(*w);
+
         // Using shared_ptr to enable copy-ability of the lambda, otherwise the
         // dispatchFunc_ would not be able to accept it as function<void()>
         std::shared_ptr<Waitable> wShared = std::move(w);
         (*dispatchFunc_)(
-            [w = std::move(wShared), error = std::move(error)]() { w->dispatch(error); });
+            [w = std::move(wShared), error = std::move(error), ready = std::move(ready)]() {
+                TInstrumentation::onDispatch(ready);
+                w->dispatch(error);
+                TInstrumentation::onFinish(ready);
+            });
     }
 
     inline void cancel_(std::unique_ptr<Waitable> w, const std::string& message)
@@ -133,15 +211,19 @@ private:
 
     inline void poll_()
     {
-        std::vector<std::unique_ptr<Waitable>> polling;
+        std::vector<detail::PendingWaitable> polling;
         polling.reserve(1000);
 
         while (true) {
+            const auto now = std::chrono::steady_clock::now();
+
             bool isPollerRunning;
             {
                 std::lock_guard<std::mutex> lock(mutex_);
 
-                std::move(waitables_.begin(), waitables_.end(), std::back_inserter(polling));
+                for (std::unique_ptr<Waitable>& w : waitables_) {
+                    polling.emplace_back(std::move(w), now);
+                }
                 waitables_.clear();
 
                 if (!active_ || polling.empty()) {
@@ -152,57 +234,86 @@ private:
             }
 
             if (!isPollerRunning) {
-                for (std::unique_ptr<Waitable>& w : polling) {
-                    cancel_(std::move(w), "Executor stoped");
+                for (detail::PendingWaitable& p : polling) {
+                    cancel_(std::move(p.w), "Executor stoped");
                 }
                 return;
             }
 
+            auto sweepStart = instrumentation_.mark();
+
             auto middleIter = polling.begin() + polling.size() / 2;
 
             std::nth_element(polling.begin(),
                              middleIter,
                              polling.end(),
                              [](const auto& a, const auto& b) {
-                                 return a->compare(*b) < std::chrono::milliseconds(0);
+                                 return a.w->compare(*b.w) < std::chrono::milliseconds(0);
                              });
 
-            std::for_each(polling.begin(), middleIter, [this](std::unique_ptr<Waitable>& w) {
+            bool isAnyPolled = false;
+
+            auto pollIfDue = [this, &now, &isAnyPolled](detail::PendingWaitable& p) {
                 try {
-                    if (w->wait(q_)) {
-                        dispatch_(std::move(w), nullptr);
+                    if (!p.w || !p.isDue(now)) {
+                        return;
                     }
-                }
-                catch (...) {
-                    dispatch_(std::move(w), std::current_exception());
-                }
-            });
 
-            std::for_each(polling.begin(), polling.end(), [this](std::unique_ptr<Waitable>& w) {
-                try {
-                    if (w && w->wait(q_)) {
-                        dispatch_(std::move(w), nullptr);
+                    isAnyPolled = true;
+
+                    instrumentation_.onWait(*p.w);
+                    if (p.w->wait(q_)) {
+                        dispatch_(std::move(p.w), nullptr);
+                    }
+                    else {
+                        p.backOff(backoff_, now);
                     }
                 }
                 catch (...) {
-                    dispatch_(std::move(w), std::current_exception());
+                    dispatch_(std::move(p.w), std::current_exception());
                 }
-            });
+            };
+
+            std::for_each(polling.begin(), middleIter, pollIfDue);
+
+            // The ones before the median are polled once more, unless they back off
+            std::for_each(polling.begin(), polling.end(), pollIfDue);
 
             // Remove dispatched waitables
             polling.erase(std::remove_if(polling.begin(),
                                          polling.end(),
-                                         std::logical_not<std::unique_ptr<Waitable>>()),
+                                         [](const detail::PendingWaitable& p) { return !p.w; }),
                           polling.end());
+
+            instrumentation_.onSweep(sweepStart, polling.size());
+
+            // Every pending waitable is backing off, so nothing blocked this sweep
+            if (!isAnyPolled && !polling.empty()) {
+                sleep_();
+            }
         }
     }
 
+    inline void sleep_()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        isPollerSleeping_ = true;
+        sleepCond_.wait_for(lock, q_, [this]() { return !active_ || !waitables_.empty(); });
+        isPollerSleeping_ = false;
+    }
+
     const std::chrono::microseconds q_;
+    const PollingBackoff backoff_;
 
     std::mutex mutex_;
+    std::condition_variable sleepCond_;
     std::vector<std::unique_ptr<Waitable>> waitables_;
     bool active_{true};
     bool isPollerRunning_{false};
+    bool isPollerSleeping_{false};
+
+    TInstrumentation instrumentation_;
 
     std::unique_ptr<TPollFunctor> pollFunc_;
     std::unique_ptr<TDispatchFunctor> dispatchFunc_;
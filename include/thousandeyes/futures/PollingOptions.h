@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief The strategies a polling #Executor can use to poll its pending #Waitable
+//! instances.
+enum class PollingMode {
+    //! \brief Waits up to the polling timeout on every pending #Waitable, one after
+    //! the other.
+    Blocking,
+
+    //! \brief Checks every pending #Waitable with a zero timeout and, if none of them
+    //! was ready, sleeps once per sweep for up to the polling timeout or until a new
+    //! #Waitable is watched.
+    Sweep,
+};
+
+//! \brief What a polling #Executor does with a watched #Waitable that is already ready.
+enum class ReadyPolicy {
+    //! \brief Queues it for the poller, like any other #Waitable.
+    Poll,
+
+    //! \brief Hands it straight to the dispatch functor, without queueing it for
+    //! the poller.
+    Dispatch,
+
+    //! \brief Dispatches it right away on the thread that watches it (e.g., the one
+    //! that calls then(), all() or observe()).
+    Inline,
+};
+
+//! \brief The bounds of the backoff that polls the #Waitable instances that have
+//! been pending for long less often.
+//!
+//! \par A #Waitable is polled on every sweep until it has been pending for the
+//! initial interval. From then on, it is polled once its age doubles, e.g., after
+//! 2x, 4x and 8x the initial interval, but at least once every max interval.
+struct PollingBackoff {
+    //! \brief The age after which a #Waitable is polled less often, or zero to poll
+    //! every #Waitable on every sweep.
+    std::chrono::microseconds initial{0};
+
+    //! \brief The maximum interval between two polls of the same #Waitable.
+    std::chrono::microseconds max{std::chrono::seconds(1)};
+};
+
+//! \brief Options that tune the behavior of a polling #Executor.
+struct PollingOptions {
+    //! \brief The strategy used to poll the pending #Waitable instances.
+    PollingMode mode{PollingMode::Blocking};
+
+    //! \brief What to do with the watched #Waitable instances that are already ready.
+    ReadyPolicy readyPolicy{ReadyPolicy::Poll};
+
+    //! \brief How to poll the #Waitable instances that have been pending for long.
+    PollingBackoff backoff{};
+};
+
+} // namespace futures
+} // namespace thousandeyes
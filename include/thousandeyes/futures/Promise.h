@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <exception>
+#include <future>
+#include <memory>
+#include <utility>
+
+#include <thousandeyes/futures/detail/ReadySignal.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief A std::future that notifies its #Executor as soon as it becomes ready.
+//!
+//! \par A #Future is obtained from a #Promise. When passed to then() or observe()
+//! without a time limit, the resulting #Waitable is not polled; instead, it is handed
+//! to the executor's Executor::ready() method by the thread that satisfies the
+//! #Promise. In every other context (e.g., all()), a #Future behaves exactly like
+//! the std::future it derives from and is polled as usual.
+//!
+//! \sa Promise
+template <class T>
+class Future : public std::future<T> {
+public:
+    Future() = default;
+
+    Future(std::future<T> f, std::shared_ptr<detail::ReadySignal> signal) :
+        std::future<T>(std::move(f)),
+        signal_(std::move(signal))
+    {}
+
+    Future(const Future& o) = delete;
+    Future& operator=(const Future& o) = delete;
+
+    Future(Future&& o) = default;
+    Future& operator=(Future&& o) = default;
+
+    //! \brief Returns the signal that is notified when the future becomes ready.
+    const std::shared_ptr<detail::ReadySignal>& readySignal() const
+    {
+        return signal_;
+    }
+
+private:
+    std::shared_ptr<detail::ReadySignal> signal_;
+};
+
+//! \brief A std::promise whose #Future pushes its dependent #Waitable to the
+//! #Executor when the promise is satisfied, instead of having it polled.
+//!
+//! \note If the promise is destroyed without being satisfied, its #Future becomes
+//! ready with a std::future_error (std::future_errc::broken_promise) and the
+//! executor is notified as well.
+//!
+//! \sa Future
+template <class T>
+class Promise {
+public:
+    Promise() : signal_(std::make_shared<detail::ReadySignal>())
+    {}
+
+    ~Promise()
+    {
+        if (signal_) {
+            // Abandon the shared state before notifying, so that the
+            // dependent waitable observes the broken promise.
+            p_ = std::promise<T>();
+            signal_->notify();
+        }
+    }
+
+    Promise(const Promise& o) = delete;
+    Promise& operator=(const Promise& o) = delete;
+
+    Promise(Promise&& o) = default;
+
+    Promise& operator=(Promise&& o)
+    {
+        Promise(std::move(o)).swap(*this);
+        return *this;
+    }
+
+    void swap(Promise& o)
+    {
+        p_.swap(o.p_);
+        signal_.swap(o.signal_);
+    }
+
+    //! \brief Returns the #Future associated with the promise.
+    //!
+    //! \throw std::future_error if the future has already been retrieved.
+    Future<T> get_future()
+    {
+        return Future<T>(p_.get_future(), signal_);
+    }
+
+    //! \brief Stores the given value in the shared state and notifies the
+    //! executor that waits on the associated #Future.
+    template <class... Args>
+    void set_value(Args&&... args)
+    {
+        p_.set_value(std::forward<Args>(args)...);
+        signal_->notify();
+    }
+
+    //! \brief Stores the given exception in the shared state and notifies the
+    //! executor that waits on the associated #Future.
+    void set_exception(std::exception_ptr error)
+    {
+        p_.set_exception(std::move(error));
+        signal_->notify();
+    }
+
+private:
+    std::promise<T> p_;
+    std::shared_ptr<detail::ReadySignal> signal_;
+};
+
+} // namespace futures
+} // namespace thousandeyes
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <thousandeyes/futures/Executor.h>
+#include <thousandeyes/futures/Instrumentation.h>
+#include <thousandeyes/futures/PollingExecutor.h>
+#include <thousandeyes/futures/PollingOptions.h>
+#include <thousandeyes/futures/Waitable.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief An implementation of the #Executor that spreads the "watched" #Waitable
+//! instances across a number of independent #PollingExecutor shards.
+//!
+//! \par Every shard owns its own queue and its own poller, so that several pollers
+//! can run concurrently instead of funneling all the #Waitable instances through a
+//! single poller. New #Waitable instances are assigned to the shards in a round-robin
+//! fashion.
+//!
+//! \par Every shard has its own TInstrumentation policy object (see
+//! PollingExecutor), which collects the metrics of that shard only.
+//!
+//! \note Each shard dispatches its polling function via its own TPollFunctor functor
+//! and, subsequently, dispatches its ready #Waitable instances via its own
+//! TDispatchFunctor functor; the functors are never shared between shards.
+template <class TPollFunctor, class TDispatchFunctor, class TInstrumentation = NoInstrumentation>
+class ShardedPollingExecutor : public Executor {
+public:
+    using Shard = PollingExecutor<TPollFunctor, TDispatchFunctor, TInstrumentation>;
+
+    //! \brief Constructs a #ShardedPollingExecutor with the given number of shards,
+    //! each one using default-constructed functors for polling and dispatching
+    //! ready #Waitables
+    //!
+    //! \param q The polling timeout.
+    //! \param shardCount The number of shards (pollers) to use, at least one.
+    //! \param options The options that tune the polling of every shard.
+    ShardedPollingExecutor(std::chrono::microseconds q,
+                           std::size_t shardCount,
+                           PollingOptions options = {})
+    {
+        shardCount = std::max<std::size_t>(shardCount, 1);
+
+        shards_.reserve(shardCount);
+        for (std::size_t i = 0; i < shardCount; ++i) {
+            shards_.push_back(std::make_shared<Shard>(q, options));
+        }
+    }
+
+    //! \brief Constructs a #ShardedPollingExecutor with the given number of shards,
+    //! each one using its own functors for polling and dispatching ready #Waitables
+    //!
+    //! \param q The polling timeout.
+    //! \param shardCount The number of shards (pollers) to use, at least one.
+    //! \param makePollFunc The factory that creates the functor each shard uses
+    //! to dispatch its polling function.
+    //! \param makeDispatchFunc The factory that creates the functor each shard uses
+    //! to dispatch its ready #Waitables.
+    //! \param options The options that tune the polling of every shard.
+    //!
+    //! \note The functors are not copied across shards: a copy of an invoker may
+    //! share its thread with the original, which stops when either is destroyed.
+    ShardedPollingExecutor(std::chrono::microseconds q,
+                           std::size_t shardCount,
+                           const std::function<TPollFunctor()>& makePollFunc,
+                           const std::function<TDispatchFunctor()>& makeDispatchFunc,
+                           PollingOptions options = {})
+    {
+        shardCount = std::max<std::size_t>(shardCount, 1);
+
+        shards_.reserve(shardCount);
+        for (std::size_t i = 0; i < shardCount; ++i) {
+            shards_.push_back(
+                std::make_shared<Shard>(q, makePollFunc(), makeDispatchFunc(), options));
+        }
+    }
+
+    ~ShardedPollingExecutor()
+    {
+        stop();
+    }
+
+    ShardedPollingExecutor(const ShardedPollingExecutor& o) = delete;
+    ShardedPollingExecutor& operator=(const ShardedPollingExecutor& o) = delete;
+
+    void watch(std::unique_ptr<Waitable> w) override final
+    {
+        auto i = nextShard_.fetch_add(1, std::memory_order_relaxed) % shards_.size();
+        shards_[i]->watch(std::move(w));
+    }
+
+    void ready(std::unique_ptr<Waitable> w) override final
+    {
+        auto i = nextShard_.fetch_add(1, std::memory_order_relaxed) % shards_.size();
+        shards_[i]->ready(std::move(w));
+    }
+
+    void stop() override final
+    {
+        for (auto& shard : shards_) {
+            shard->stop();
+        }
+    }
+
+    //! \brief Returns the number of shards used by the executor.
+    std::size_t shardCount() const
+    {
+        return shards_.size();
+    }
+
+    //! \brief The policy object that collects the metrics of the given shard.
+    //!
+    //! \param shard The index of the shard, less than shardCount().
+    const TInstrumentation& instrumentation(std::size_t shard) const
+    {
+        return shards_[shard]->instrumentation();
+    }
+
+private:
+    std::vector<std::shared_ptr<Shard>> shards_;
+    std::atomic<std::size_t> nextShard_{0};
+};
+
+} // namespace futures
+} // namespace thousandeyes
@@ -11,9 +11,13 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <exception>
+#include <memory>
 #include <utility>
 
+#include <thousandeyes/futures/detail/WaitablePool.h>
+
 namespace thousandeyes {
 namespace futures {
 
@@ -53,6 +57,32 @@ public:
 
     virtual ~Waitable() = default;
 
+    //! \brief Allocates the objects of every #Waitable type from a process-wide
+    //! pool that recycles their memory, even across threads.
+    static void* operator new(std::size_t size)
+    {
+        return detail::WaitablePool::allocate(size);
+    }
+
+    static void operator delete(void* p) noexcept
+    {
+        detail::WaitablePool::deallocate(p);
+    }
+
+    //! \brief Allocates the object with the given allocator, which is also used
+    //! to free it once it gets deleted.
+    template <class TAlloc>
+    static void* operator new(std::size_t size, std::allocator_arg_t, const TAlloc& alloc)
+    {
+        return detail::WaitablePool::allocate(size, alloc);
+    }
+
+    template <class TAlloc>
+    static void operator delete(void* p, std::allocator_arg_t, const TAlloc& /* alloc */) noexcept
+    {
+        detail::WaitablePool::deallocate(p);
+    }
+
     //! \brief Waits, at most, the given amount of time to determine whether
     //! the object is ready or not.
     //!
@@ -106,6 +136,15 @@ public:
         return epochTimestamp >= epochDeadline_;
     }
 
+    //! \brief Returns the object's deadline.
+    //!
+    //! \return the deadline in number of ms since the Epoch, or zero if the object
+    //! was created without a deadline.
+    inline std::chrono::milliseconds deadline() const
+    {
+        return epochDeadline_;
+    }
+
 private:
     std::chrono::milliseconds epochDeadline_{0};
 };
@@ -22,6 +22,7 @@
 #include <thousandeyes/futures/detail/FutureWithTuple.h>
 #include <thousandeyes/futures/detail/typetraits.h>
 #include <thousandeyes/futures/Executor.h>
+#include <thousandeyes/futures/Waitable.h>
 
 namespace thousandeyes {
 namespace futures {
@@ -491,5 +492,228 @@ all_accepts_fwd_iterator_t<TForwardIterator> all(TForwardIterator first, TForwar
     return all<TForwardIterator>(Default<Executor>(), std::chrono::hours(1), first, last);
 }
 
+//! \brief Creates a future that becomes ready when all the input futures become ready,
+//! allocating everything it needs with the given allocator.
+//!
+//! \par The given allocator is used for the shared state of the resulting future and
+//! for the #Waitable that waits for the input futures.
+//!
+//! \param alloc The allocator to use.
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa WaitableTimedOutException
+//!
+//! \return An std::future<TContainer> that contains all the input futures, where
+//! all the contained futures are ready.
+template <class TContainer, class TAlloc>
+std::future<typename std::decay<TContainer>::type> all(std::allocator_arg_t,
+                                                       const TAlloc& alloc,
+                                                       std::shared_ptr<Executor> executor,
+                                                       std::chrono::microseconds timeLimit,
+                                                       TContainer&& futures)
+{
+    std::promise<typename std::decay<TContainer>::type> p(std::allocator_arg, alloc);
+
+    auto result = p.get_future();
+
+    executor->watch(std::unique_ptr<Waitable>(
+        new (std::allocator_arg, alloc) detail::FutureWithContainer<TContainer>(
+            std::move(timeLimit),
+            std::forward<TContainer>(futures),
+            std::move(p))));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready,
+//! allocating everything it needs with the given allocator.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param alloc The allocator to use.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa Default, WaitableTimedOutException
+//!
+//! \return An std::future<TContainer> that contains all the input futures, where
+//! all the contained futures are ready.
+template <class TContainer, class TAlloc>
+std::future<typename std::decay<TContainer>::type> all(std::allocator_arg_t,
+                                                       const TAlloc& alloc,
+                                                       TContainer&& futures)
+{
+    return all(std::allocator_arg,
+               alloc,
+               Default<Executor>(),
+               std::chrono::hours(1),
+               std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready,
+//! allocating everything it needs with the given allocator.
+//!
+//! \par The given allocator is used for the shared state of the resulting future and
+//! for the #Waitable that waits for the input futures.
+//!
+//! \param alloc The allocator to use.
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple> that contains all the input futures, where
+//! all the contained futures are ready.
+template <class TAlloc, typename... Args>
+std::future<std::tuple<std::future<Args>...>> all(std::allocator_arg_t,
+                                                  const TAlloc& alloc,
+                                                  std::shared_ptr<Executor> executor,
+                                                  std::chrono::microseconds timeLimit,
+                                                  std::tuple<std::future<Args>...> futures)
+{
+    std::promise<std::tuple<std::future<Args>...>> p(std::allocator_arg, alloc);
+
+    auto result = p.get_future();
+
+    executor->watch(std::unique_ptr<Waitable>(new (std::allocator_arg, alloc)
+                                                  detail::FutureWithTuple<Args...>(
+                                                      std::move(timeLimit),
+                                                      std::move(futures),
+                                                      std::move(p))));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready,
+//! allocating everything it needs with the given allocator.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param alloc The allocator to use.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple> that contains all the input futures, where
+//! all the contained futures are ready.
+template <class TAlloc, typename... Args>
+std::future<std::tuple<std::future<Args>...>> all(std::allocator_arg_t,
+                                                  const TAlloc& alloc,
+                                                  std::tuple<std::future<Args>...> futures)
+{
+    return all(std::allocator_arg,
+               alloc,
+               Default<Executor>(),
+               std::chrono::hours(1),
+               std::move(futures));
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready,
+//! allocating everything it needs with the given allocator.
+//!
+//! \par The given allocator is used for the shared state of the resulting future and
+//! for the #Waitable that waits for the input futures.
+//!
+//! \param alloc The allocator to use.
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the client code finishes extracting
+//! all the results from the futures in [first, last) or until the continuations
+//! attached to the resulting future, using then(), finish processing.
+//!
+//! \sa then(), WaitableTimedOutException
+//!
+//! \return A std::future<std::tuple> with the input ForwardIterators, where all the
+//! futures in range [first, last) are ready.
+template <class TForwardIterator, class TAlloc>
+all_accepts_fwd_iterator_t<TForwardIterator> all(std::allocator_arg_t,
+                                                 const TAlloc& alloc,
+                                                 std::shared_ptr<Executor> executor,
+                                                 std::chrono::microseconds timeLimit,
+                                                 TForwardIterator first,
+                                                 TForwardIterator last)
+{
+    std::promise<std::tuple<TForwardIterator, TForwardIterator>> p(std::allocator_arg, alloc);
+
+    auto result = p.get_future();
+
+    executor->watch(std::unique_ptr<Waitable>(
+        new (std::allocator_arg, alloc) detail::FutureWithIterators<TForwardIterator>(
+            std::move(timeLimit),
+            first,
+            last,
+            std::move(p))));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready,
+//! allocating everything it needs with the given allocator.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param alloc The allocator to use.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the client code finishes extracting
+//! all the results from the futures in [first, last) or until the continuations
+//! attached to the resulting future, using then(), finish processing.
+//!
+//! \sa Default, then(), WaitableTimedOutException
+//!
+//! \return A std::future<std::tuple> with the input ForwardIterators, where all the
+//! futures in range [first, last) are ready.
+template <class TForwardIterator, class TAlloc>
+all_accepts_fwd_iterator_t<TForwardIterator> all(std::allocator_arg_t,
+                                                 const TAlloc& alloc,
+                                                 TForwardIterator first,
+                                                 TForwardIterator last)
+{
+    return all(std::allocator_arg,
+               alloc,
+               Default<Executor>(),
+               std::chrono::hours(1),
+               std::move(first),
+               std::move(last));
+}
+
 } // namespace futures
 } // namespace thousandeyes
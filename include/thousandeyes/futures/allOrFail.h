@@ -0,0 +1,488 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <future>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+#include <thousandeyes/futures/all.h>
+#include <thousandeyes/futures/Default.h>
+#include <thousandeyes/futures/detail/FailFastWithContainer.h>
+#include <thousandeyes/futures/detail/FailFastWithIterators.h>
+#include <thousandeyes/futures/detail/FailFastWithTuple.h>
+#include <thousandeyes/futures/Executor.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par Unlike all(), the resulting future does not wait for the rest of the futures
+//! in the given container once any of them is found to hold an exception; it becomes
+//! ready with that exception instead, and the remaining futures are not polled again.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \note In order to tell whether a ready std::future holds an exception, its result
+//! has to be extracted; the futures that hold values are replaced by equivalent ready
+//! futures, so that their values can still be obtained from the resulting container.
+//!
+//! \note On failure, the futures that are not ready yet are destroyed along with the
+//! container, after the resulting future becomes ready. Futures that block on
+//! destruction (i.e., the ones returned by std::async) keep blocking the executor.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<TContainer> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <class TContainer>
+std::future<typename std::decay<TContainer>::type> allOrFail(std::shared_ptr<Executor> executor,
+                                                             std::chrono::microseconds timeLimit,
+                                                             TContainer&& futures)
+{
+    std::promise<typename std::decay<TContainer>::type> p;
+
+    auto result = p.get_future();
+
+    executor->watch(std::make_unique<detail::FailFastWithContainer<TContainer>>(
+        std::move(timeLimit), std::forward<TContainer>(futures), std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<TContainer> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <class TContainer>
+std::future<typename std::decay<TContainer>::type> allOrFail(std::shared_ptr<Executor> executor,
+                                                             TContainer&& futures)
+{
+    return allOrFail<TContainer>(std::move(executor),
+                                 std::chrono::hours(1),
+                                 std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<TContainer> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <class TContainer>
+std::future<typename std::decay<TContainer>::type> allOrFail(std::chrono::microseconds timeLimit,
+                                                             TContainer&& futures)
+{
+    return allOrFail<TContainer>(Default<Executor>(),
+                                 std::move(timeLimit),
+                                 std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<TContainer> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <class TContainer>
+std::future<typename std::decay<TContainer>::type> allOrFail(TContainer&& futures)
+{
+    return allOrFail<TContainer>(std::chrono::hours(1), std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par Unlike all(), the resulting future does not wait for the rest of the futures
+//! in the given tuple once any of them is found to hold an exception; it becomes
+//! ready with that exception instead, and the remaining futures are not polled again.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <typename... Args>
+std::future<std::tuple<std::future<Args>...>> allOrFail(std::shared_ptr<Executor> executor,
+                                                        std::chrono::microseconds timeLimit,
+                                                        std::tuple<std::future<Args>...> futures)
+{
+    std::promise<std::tuple<std::future<Args>...>> p;
+
+    auto result = p.get_future();
+
+    executor->watch(std::make_unique<detail::FailFastWithTuple<Args...>>(std::move(timeLimit),
+                                                                         std::move(futures),
+                                                                         std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <typename... Args>
+std::future<std::tuple<std::future<Args>...>> allOrFail(std::shared_ptr<Executor> executor,
+                                                        std::tuple<std::future<Args>...> futures)
+{
+    return allOrFail<Args...>(std::move(executor), std::chrono::hours(1), std::move(futures));
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <typename... Args>
+std::future<std::tuple<std::future<Args>...>> allOrFail(std::chrono::microseconds timeLimit,
+                                                        std::tuple<std::future<Args>...> futures)
+{
+    return allOrFail<Args...>(Default<Executor>(), std::move(timeLimit), std::move(futures));
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param futures The input futures as a tuple.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <typename... Args>
+std::future<std::tuple<std::future<Args>...>> allOrFail(std::tuple<std::future<Args>...> futures)
+{
+    return allOrFail<Args...>(std::chrono::hours(1), std::move(futures));
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures... The input futures as variable arguments.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <typename Arg, typename... Args>
+std::future<std::tuple<std::future<Arg>, std::future<Args>...>> allOrFail(
+    std::shared_ptr<Executor> executor,
+    std::chrono::microseconds timeLimit,
+    std::future<Arg> future,
+    std::future<Args>... futures)
+{
+    using Tuple = std::tuple<std::future<Arg>, std::future<Args>...>;
+
+    return allOrFail<Arg, Args...>(executor,
+                                   std::move(timeLimit),
+                                   Tuple{std::move(future), std::move(futures)...});
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param futures... The input futures as variable arguments.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <typename Arg, typename... Args>
+std::future<std::tuple<std::future<Arg>, std::future<Args>...>>
+allOrFail(std::shared_ptr<Executor> executor, std::future<Arg> future, std::future<Args>... futures)
+{
+    return allOrFail<Arg, Args...>(std::move(executor),
+                                   std::chrono::hours(1),
+                                   std::move(future),
+                                   std::move(futures)...);
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures... The input futures as variable arguments.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <typename Arg, typename... Args>
+std::future<std::tuple<std::future<Arg>, std::future<Args>...>> allOrFail(
+    std::chrono::microseconds timeLimit,
+    std::future<Arg> future,
+    std::future<Args>... futures)
+{
+    return allOrFail<Arg, Args...>(Default<Executor>(),
+                                   std::move(timeLimit),
+                                   std::move(future),
+                                   std::move(futures)...);
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param futures... The input futures as variable arguments.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple> that contains all the input futures, where
+//! all the contained futures are ready and hold values.
+template <typename Arg, typename... Args>
+std::future<std::tuple<std::future<Arg>, std::future<Args>...>> allOrFail(
+    std::future<Arg> future,
+    std::future<Args>... futures)
+{
+    return allOrFail<Arg, Args...>(Default<Executor>(),
+                                   std::chrono::hours(1),
+                                   std::move(future),
+                                   std::move(futures)...);
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par Unlike all(), the resulting future does not wait for the rest of the futures
+//! in range [first, last) once any of them is found to hold an exception; it becomes
+//! ready with that exception instead, and the remaining futures are not polled again.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes
+//! ready and, if it holds values, until the client code finishes extracting them.
+//! The future that holds the exception is left without a shared state.
+//!
+//! \sa all(), then(), WaitableTimedOutException
+//!
+//! \return A std::future<std::tuple> with the input ForwardIterators, where all the
+//! futures in range [first, last) are ready and hold values.
+template <class TForwardIterator>
+all_accepts_fwd_iterator_t<TForwardIterator> allOrFail(std::shared_ptr<Executor> executor,
+                                                       std::chrono::microseconds timeLimit,
+                                                       TForwardIterator first,
+                                                       TForwardIterator last)
+{
+    std::promise<std::tuple<TForwardIterator, TForwardIterator>> p;
+
+    auto result = p.get_future();
+
+    executor->watch(
+        std::make_unique<detail::FailFastWithIterators<TForwardIterator>>(std::move(timeLimit),
+                                                                          first,
+                                                                          last,
+                                                                          std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes
+//! ready and, if it holds values, until the client code finishes extracting them.
+//!
+//! \sa all(), then(), WaitableTimedOutException
+//!
+//! \return A std::future<std::tuple> with the input ForwardIterators, where all the
+//! futures in range [first, last) are ready and hold values.
+template <class TForwardIterator>
+all_accepts_fwd_iterator_t<TForwardIterator> allOrFail(std::shared_ptr<Executor> executor,
+                                                       TForwardIterator first,
+                                                       TForwardIterator last)
+{
+    return allOrFail<TForwardIterator>(std::move(executor), std::chrono::hours(1), first, last);
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes
+//! ready and, if it holds values, until the client code finishes extracting them.
+//!
+//! \sa all(), then(), Default, WaitableTimedOutException
+//!
+//! \return A std::future<std::tuple> with the input ForwardIterators, where all the
+//! futures in range [first, last) are ready and hold values.
+template <class TForwardIterator>
+all_accepts_fwd_iterator_t<TForwardIterator> allOrFail(std::chrono::microseconds timeLimit,
+                                                       TForwardIterator first,
+                                                       TForwardIterator last)
+{
+    return allOrFail<TForwardIterator>(Default<Executor>(), std::move(timeLimit), first, last);
+}
+
+//! \brief Creates a future that becomes ready when all the input futures become ready
+//! or as soon as one of them becomes ready with an exception.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes
+//! ready and, if it holds values, until the client code finishes extracting them.
+//!
+//! \sa all(), then(), Default, WaitableTimedOutException
+//!
+//! \return A std::future<std::tuple> with the input ForwardIterators, where all the
+//! futures in range [first, last) are ready and hold values.
+template <class TForwardIterator>
+all_accepts_fwd_iterator_t<TForwardIterator> allOrFail(TForwardIterator first,
+                                                       TForwardIterator last)
+{
+    return allOrFail<TForwardIterator>(Default<Executor>(), std::chrono::hours(1), first, last);
+}
+
+} // namespace futures
+} // namespace thousandeyes
@@ -0,0 +1,484 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+#include <thousandeyes/futures/Default.h>
+#include <thousandeyes/futures/detail/FirstWithContainer.h>
+#include <thousandeyes/futures/detail/FirstWithIterators.h>
+#include <thousandeyes/futures/detail/FirstWithTuple.h>
+#include <thousandeyes/futures/Executor.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par The resulting future becomes ready as soon as any of the futures in the given
+//! container becomes ready, and the rest of them are not waited for. If more than one
+//! of them are ready, the one that comes first in the container wins.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for any of the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If none of the input futures becomes ready within the given timeLimit, the
+//! resulting future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, TContainer>> with the index of the
+//! ready future and the container with all the input futures. The index is equal to
+//! the size of the container if the container is empty.
+template <class TContainer>
+std::future<std::tuple<std::size_t, typename std::decay<TContainer>::type>> any(
+    std::shared_ptr<Executor> executor,
+    std::chrono::microseconds timeLimit,
+    TContainer&& futures)
+{
+    std::promise<std::tuple<std::size_t, typename std::decay<TContainer>::type>> p;
+
+    auto result = p.get_future();
+
+    executor->watch(std::make_unique<detail::FirstWithContainer<TContainer>>(
+        std::move(timeLimit), std::forward<TContainer>(futures), std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If none of the input futures becomes ready within a maximum threshold defined
+//! by the library (typically 1h), the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, TContainer>> with the index of the
+//! ready future and the container with all the input futures. The index is equal to
+//! the size of the container if the container is empty.
+template <class TContainer>
+std::future<std::tuple<std::size_t, typename std::decay<TContainer>::type>> any(
+    std::shared_ptr<Executor> executor,
+    TContainer&& futures)
+{
+    return any<TContainer>(std::move(executor),
+                           std::chrono::hours(1),
+                           std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for any of the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If none of the input futures becomes ready within the given timeLimit, the
+//! resulting future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, TContainer>> with the index of the
+//! ready future and the container with all the input futures. The index is equal to
+//! the size of the container if the container is empty.
+template <class TContainer>
+std::future<std::tuple<std::size_t, typename std::decay<TContainer>::type>> any(
+    std::chrono::microseconds timeLimit,
+    TContainer&& futures)
+{
+    return any<TContainer>(Default<Executor>(),
+                           std::move(timeLimit),
+                           std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If none of the input futures becomes ready within a maximum threshold defined
+//! by the library (typically 1h), the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, TContainer>> with the index of the
+//! ready future and the container with all the input futures. The index is equal to
+//! the size of the container if the container is empty.
+template <class TContainer>
+std::future<std::tuple<std::size_t, typename std::decay<TContainer>::type>> any(
+    TContainer&& futures)
+{
+    return any<TContainer>(std::chrono::hours(1), std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par The resulting future becomes ready as soon as any of the futures in the given
+//! tuple becomes ready, and the rest of them are not waited for. If more than one of
+//! them are ready, the one that comes first in the tuple wins.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for any of the given futures to become ready.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If none of the input futures becomes ready within the given timeLimit, the
+//! resulting future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, std::tuple>> with the index of the
+//! ready future and the tuple with all the input futures.
+template <typename... Args>
+std::future<std::tuple<std::size_t, std::tuple<std::future<Args>...>>> any(
+    std::shared_ptr<Executor> executor,
+    std::chrono::microseconds timeLimit,
+    std::tuple<std::future<Args>...> futures)
+{
+    std::promise<std::tuple<std::size_t, std::tuple<std::future<Args>...>>> p;
+
+    auto result = p.get_future();
+
+    executor->watch(std::make_unique<detail::FirstWithTuple<Args...>>(std::move(timeLimit),
+                                                                      std::move(futures),
+                                                                      std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If none of the input futures becomes ready within a maximum threshold defined
+//! by the library (typically 1h), the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, std::tuple>> with the index of the
+//! ready future and the tuple with all the input futures.
+template <typename... Args>
+std::future<std::tuple<std::size_t, std::tuple<std::future<Args>...>>> any(
+    std::shared_ptr<Executor> executor,
+    std::tuple<std::future<Args>...> futures)
+{
+    return any<Args...>(std::move(executor), std::chrono::hours(1), std::move(futures));
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for any of the given futures to become ready.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If none of the input futures becomes ready within the given timeLimit, the
+//! resulting future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, std::tuple>> with the index of the
+//! ready future and the tuple with all the input futures.
+template <typename... Args>
+std::future<std::tuple<std::size_t, std::tuple<std::future<Args>...>>> any(
+    std::chrono::microseconds timeLimit,
+    std::tuple<std::future<Args>...> futures)
+{
+    return any<Args...>(Default<Executor>(), std::move(timeLimit), std::move(futures));
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param futures The input futures as a tuple.
+//!
+//! \note If none of the input futures becomes ready within a maximum threshold defined
+//! by the library (typically 1h), the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, std::tuple>> with the index of the
+//! ready future and the tuple with all the input futures.
+template <typename... Args>
+std::future<std::tuple<std::size_t, std::tuple<std::future<Args>...>>> any(
+    std::tuple<std::future<Args>...> futures)
+{
+    return any<Args...>(std::chrono::hours(1), std::move(futures));
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par The resulting future becomes ready as soon as any of the futures given as
+//! arguments becomes ready, and the rest of them are not waited for. If more than one
+//! of them are ready, the one that comes first in the arguments wins.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for any of the given futures to become ready.
+//! \param futures... The input futures as variable arguments.
+//!
+//! \note If none of the input futures becomes ready within the given timeLimit, the
+//! resulting future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, std::tuple>> with the index of the
+//! ready future and the tuple with all the input futures.
+template <typename Arg, typename... Args>
+std::future<std::tuple<std::size_t, std::tuple<std::future<Arg>, std::future<Args>...>>> any(
+    std::shared_ptr<Executor> executor,
+    std::chrono::microseconds timeLimit,
+    std::future<Arg> future,
+    std::future<Args>... futures)
+{
+    using Tuple = std::tuple<std::future<Arg>, std::future<Args>...>;
+
+    return any<Arg, Args...>(executor,
+                             std::move(timeLimit),
+                             Tuple{std::move(future), std::move(futures)...});
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param futures... The input futures as variable arguments.
+//!
+//! \note If none of the input futures becomes ready within a maximum threshold defined
+//! by the library (typically 1h), the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, std::tuple>> with the index of the
+//! ready future and the tuple with all the input futures.
+template <typename Arg, typename... Args>
+std::future<std::tuple<std::size_t, std::tuple<std::future<Arg>, std::future<Args>...>>> any(
+    std::shared_ptr<Executor> executor,
+    std::future<Arg> future,
+    std::future<Args>... futures)
+{
+    return any<Arg, Args...>(std::move(executor),
+                             std::chrono::hours(1),
+                             std::move(future),
+                             std::move(futures)...);
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for any of the given futures to become ready.
+//! \param futures... The input futures as variable arguments.
+//!
+//! \note If none of the input futures becomes ready within the given timeLimit, the
+//! resulting future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, std::tuple>> with the index of the
+//! ready future and the tuple with all the input futures.
+template <typename Arg, typename... Args>
+std::future<std::tuple<std::size_t, std::tuple<std::future<Arg>, std::future<Args>...>>> any(
+    std::chrono::microseconds timeLimit,
+    std::future<Arg> future,
+    std::future<Args>... futures)
+{
+    return any<Arg, Args...>(Default<Executor>(),
+                             std::move(timeLimit),
+                             std::move(future),
+                             std::move(futures)...);
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param futures... The input futures as variable arguments.
+//!
+//! \note If none of the input futures becomes ready within a maximum threshold defined
+//! by the library (typically 1h), the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::size_t, std::tuple>> with the index of the
+//! ready future and the tuple with all the input futures.
+template <typename Arg, typename... Args>
+std::future<std::tuple<std::size_t, std::tuple<std::future<Arg>, std::future<Args>...>>> any(
+    std::future<Arg> future,
+    std::future<Args>... futures)
+{
+    return any<Arg, Args...>(Default<Executor>(),
+                             std::chrono::hours(1),
+                             std::move(future),
+                             std::move(futures)...);
+}
+
+//! \brief SFINAE meta-type that resolves to the result of any() for a forward iterator range.
+template <class TIterator>
+using any_accepts_fwd_iterator_t = typename std::enable_if<
+    std::is_convertible<typename std::iterator_traits<TIterator>::iterator_category,
+                        std::forward_iterator_tag>::value,
+    std::future<std::tuple<std::size_t, TIterator>>>::type;
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par The resulting future becomes ready as soon as any of the futures in range
+//! [first, last) becomes ready, and the rest of them are not waited for. If more than
+//! one of them are ready, the one that comes first in the range wins.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for any of the given futures to become ready.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If none of the input futures becomes ready within the given timeLimit, the
+//! resulting future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes ready
+//! and the client code finishes extracting the results from the futures in [first, last).
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return A std::future<std::tuple<std::size_t, TForwardIterator>> with the index of
+//! the ready future in [first, last) and an iterator to it. If the range is empty, the
+//! index is 0 and the iterator is equal to last.
+template <class TForwardIterator>
+any_accepts_fwd_iterator_t<TForwardIterator> any(std::shared_ptr<Executor> executor,
+                                                 std::chrono::microseconds timeLimit,
+                                                 TForwardIterator first,
+                                                 TForwardIterator last)
+{
+    std::promise<std::tuple<std::size_t, TForwardIterator>> p;
+
+    auto result = p.get_future();
+
+    executor->watch(
+        std::make_unique<detail::FirstWithIterators<TForwardIterator>>(std::move(timeLimit),
+                                                                       first,
+                                                                       last,
+                                                                       std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If none of the input futures becomes ready within a maximum threshold defined
+//! by the library (typically 1h), the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes ready
+//! and the client code finishes extracting the results from the futures in [first, last).
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return A std::future<std::tuple<std::size_t, TForwardIterator>> with the index of
+//! the ready future in [first, last) and an iterator to it. If the range is empty, the
+//! index is 0 and the iterator is equal to last.
+template <class TForwardIterator>
+any_accepts_fwd_iterator_t<TForwardIterator> any(std::shared_ptr<Executor> executor,
+                                                 TForwardIterator first,
+                                                 TForwardIterator last)
+{
+    return any<TForwardIterator>(std::move(executor), std::chrono::hours(1), first, last);
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for any of the given futures to become ready.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If none of the input futures becomes ready within the given timeLimit, the
+//! resulting future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes ready
+//! and the client code finishes extracting the results from the futures in [first, last).
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return A std::future<std::tuple<std::size_t, TForwardIterator>> with the index of
+//! the ready future in [first, last) and an iterator to it. If the range is empty, the
+//! index is 0 and the iterator is equal to last.
+template <class TForwardIterator>
+any_accepts_fwd_iterator_t<TForwardIterator> any(std::chrono::microseconds timeLimit,
+                                                 TForwardIterator first,
+                                                 TForwardIterator last)
+{
+    return any<TForwardIterator>(Default<Executor>(), std::move(timeLimit), first, last);
+}
+
+//! \brief Creates a future that becomes ready when any of the input futures becomes ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If none of the input futures becomes ready within a maximum threshold defined
+//! by the library (typically 1h), the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes ready
+//! and the client code finishes extracting the results from the futures in [first, last).
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return A std::future<std::tuple<std::size_t, TForwardIterator>> with the index of
+//! the ready future in [first, last) and an iterator to it. If the range is empty, the
+//! index is 0 and the iterator is equal to last.
+template <class TForwardIterator>
+any_accepts_fwd_iterator_t<TForwardIterator> any(TForwardIterator first, TForwardIterator last)
+{
+    return any<TForwardIterator>(Default<Executor>(), std::chrono::hours(1), first, last);
+}
+
+} // namespace futures
+} // namespace thousandeyes
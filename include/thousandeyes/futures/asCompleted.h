@@ -0,0 +1,169 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+#include <thousandeyes/futures/Default.h>
+#include <thousandeyes/futures/detail/FuturesAsCompleted.h>
+#include <thousandeyes/futures/Executor.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief A thread-safe channel of ready futures, in the order in which they became
+//! ready, as returned by asCompleted().
+//!
+//! \par Copies of a channel share the same state, so the ready futures can be
+//! consumed by multiple threads; each future is handed to exactly one of them.
+template <class TFuture>
+class CompletionChannel {
+public:
+    explicit CompletionChannel(std::shared_ptr<detail::CompletionState<TFuture>> state) :
+        state_(std::move(state))
+    {}
+
+    //! \brief Blocks until the next future becomes ready or until all the futures have
+    //! been handed out.
+    //!
+    //! \param f The object that receives the next ready future.
+    //!
+    //! \throws WaitableWaitException If the #Executor stops, or its subclass,
+    //! WaitableTimedOutException, if the time limit expires, before all the futures
+    //! become ready. The futures that were found ready until then are handed out
+    //! before the exception is thrown.
+    //!
+    //! \return True if f was assigned a ready future, false if all the futures have
+    //! already been handed out.
+    bool pop(TFuture& f)
+    {
+        return state_->pop(f);
+    }
+
+private:
+    std::shared_ptr<detail::CompletionState<TFuture>> state_;
+};
+
+//! \brief The type of the channel that asCompleted() returns for a container of futures.
+template <class TContainer>
+using as_completed_t = CompletionChannel<typename std::decay<TContainer>::type::value_type>;
+
+//! \brief Creates a channel that hands out the input futures as soon as each one of
+//! them becomes ready.
+//!
+//! \par Unlike calling observe() on every input future, all the futures are watched
+//! by the executor as a single #Waitable, which moves each ready future into the
+//! channel. Since the futures are moved out of the container, the memory of every
+//! result is released as soon as the client code consumes its future.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the channel throws a WaitableTimedOutException once the futures
+//! that became ready until then are handed out.
+//!
+//! \sa CompletionChannel, all(), any(), WaitableTimedOutException
+//!
+//! \return A CompletionChannel that hands out the input futures as they become ready.
+template <class TContainer>
+as_completed_t<TContainer> asCompleted(std::shared_ptr<Executor> executor,
+                                       std::chrono::microseconds timeLimit,
+                                       TContainer&& futures)
+{
+    using Future = typename std::decay<TContainer>::type::value_type;
+
+    auto state = std::make_shared<detail::CompletionState<Future>>();
+
+    executor->watch(std::make_unique<detail::FuturesAsCompleted<TContainer>>(
+        std::move(timeLimit), std::forward<TContainer>(futures), state));
+
+    return as_completed_t<TContainer>(std::move(state));
+}
+
+//! \brief Creates a channel that hands out the input futures as soon as each one of
+//! them becomes ready.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the channel throws a
+//! WaitableTimedOutException once the futures that became ready until then are
+//! handed out.
+//!
+//! \sa CompletionChannel, all(), any(), WaitableTimedOutException
+//!
+//! \return A CompletionChannel that hands out the input futures as they become ready.
+template <class TContainer>
+as_completed_t<TContainer> asCompleted(std::shared_ptr<Executor> executor,
+                                       TContainer&& futures)
+{
+    return asCompleted<TContainer>(std::move(executor),
+                                   std::chrono::hours(1),
+                                   std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a channel that hands out the input futures as soon as each one of
+//! them becomes ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the channel throws a WaitableTimedOutException once the futures
+//! that became ready until then are handed out.
+//!
+//! \sa CompletionChannel, all(), any(), Default, WaitableTimedOutException
+//!
+//! \return A CompletionChannel that hands out the input futures as they become ready.
+template <class TContainer>
+as_completed_t<TContainer> asCompleted(std::chrono::microseconds timeLimit,
+                                       TContainer&& futures)
+{
+    return asCompleted<TContainer>(Default<Executor>(),
+                                   std::move(timeLimit),
+                                   std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a channel that hands out the input futures as soon as each one of
+//! them becomes ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the channel throws a
+//! WaitableTimedOutException once the futures that became ready until then are
+//! handed out.
+//!
+//! \sa CompletionChannel, all(), any(), Default, WaitableTimedOutException
+//!
+//! \return A CompletionChannel that hands out the input futures as they become ready.
+template <class TContainer>
+as_completed_t<TContainer> asCompleted(TContainer&& futures)
+{
+    return asCompleted<TContainer>(Default<Executor>(),
+                                   std::chrono::hours(1),
+                                   std::forward<TContainer>(futures));
+}
+
+} // namespace futures
+} // namespace thousandeyes
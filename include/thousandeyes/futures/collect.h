@@ -0,0 +1,407 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <thousandeyes/futures/CollectPolicy.h>
+#include <thousandeyes/futures/Default.h>
+#include <thousandeyes/futures/detail/CollectWithContainer.h>
+#include <thousandeyes/futures/detail/CollectWithIterators.h>
+#include <thousandeyes/futures/detail/CollectWithTuple.h>
+#include <thousandeyes/futures/detail/typetraits.h>
+#include <thousandeyes/futures/Executor.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief SFINAE meta-type that resolves to the result of collecting the values of
+//! a container of futures.
+template <class TContainer>
+using collect_container_t = std::future<detail::collect_result_t<
+    detail::future_value_t<typename std::decay<TContainer>::type::value_type>>>;
+
+//! \brief SFINAE meta-type that resolves to the result of collecting the values of
+//! a forward iterator range of futures.
+template <class TIterator>
+using collect_fwd_iterator_t = typename std::enable_if<
+    std::is_convertible<typename std::iterator_traits<TIterator>::iterator_category,
+                        std::forward_iterator_tag>::value,
+    std::future<detail::collect_result_t<
+        detail::future_value_t<typename std::iterator_traits<TIterator>::value_type>>>>::type;
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \par Unlike all(), which hands back the container of the input futures, the values
+//! are moved out of the ready futures, in order, into a single vector, while the
+//! resulting future is being dispatched. The Policy template parameter chooses what
+//! happens with the input futures that hold an exception (see #CollectPolicy).
+//!
+//! \par Void futures have no values to collect: for them, the resulting future is an
+//! std::future<void>, which becomes ready once all of them are ready and, unless the
+//! Policy is CollectPolicy::SkipFailed, holds the first exception found.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa all(), CollectPolicy, WaitableTimedOutException
+//!
+//! \return An std::future<std::vector> with the values of the input futures, or an
+//! std::future<void> for void input futures.
+template <CollectPolicy Policy = CollectPolicy::RethrowFirst, class TContainer>
+collect_container_t<TContainer> collect(std::shared_ptr<Executor> executor,
+                                        std::chrono::microseconds timeLimit,
+                                        TContainer&& futures)
+{
+    std::promise<detail::collect_result_t<
+        detail::future_value_t<typename std::decay<TContainer>::type::value_type>>> p;
+
+    auto result = p.get_future();
+
+    executor->watch(std::make_unique<detail::CollectWithContainer<Policy, TContainer>>(
+        std::move(timeLimit), std::forward<TContainer>(futures), std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), CollectPolicy, WaitableTimedOutException
+//!
+//! \return An std::future<std::vector> with the values of the input futures, or an
+//! std::future<void> for void input futures.
+template <CollectPolicy Policy = CollectPolicy::RethrowFirst, class TContainer>
+collect_container_t<TContainer> collect(std::shared_ptr<Executor> executor,
+                                        TContainer&& futures)
+{
+    return collect<Policy, TContainer>(std::move(executor),
+                                       std::chrono::hours(1),
+                                       std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa all(), CollectPolicy, Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::vector> with the values of the input futures, or an
+//! std::future<void> for void input futures.
+template <CollectPolicy Policy = CollectPolicy::RethrowFirst, class TContainer>
+collect_container_t<TContainer> collect(std::chrono::microseconds timeLimit,
+                                        TContainer&& futures)
+{
+    return collect<Policy, TContainer>(Default<Executor>(),
+                                       std::move(timeLimit),
+                                       std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), CollectPolicy, Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::vector> with the values of the input futures, or an
+//! std::future<void> for void input futures.
+template <CollectPolicy Policy = CollectPolicy::RethrowFirst, class TContainer>
+collect_container_t<TContainer> collect(TContainer&& futures)
+{
+    return collect<Policy, TContainer>(Default<Executor>(),
+                                       std::chrono::hours(1),
+                                       std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \par The values are moved out of the ready futures, in order, into a single
+//! tuple, while the resulting future is being dispatched. If any of the input futures
+//! holds an exception, the resulting future becomes ready with the first such
+//! exception, in the order of the tuple.
+//!
+//! \note Since a tuple cannot hold a void value, none of the input futures may be an
+//! std::future<void>; all() accepts such tuples instead.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<Args...>> with the values of the input futures.
+template <typename... Args>
+std::future<detail::collect_tuple_t<Args...>> collect(std::shared_ptr<Executor> executor,
+                                                      std::chrono::microseconds timeLimit,
+                                                      std::tuple<std::future<Args>...> futures)
+{
+    static_assert(!std::disjunction<std::is_void<Args>...>::value,
+                  "collect() cannot gather a tuple of futures that includes std::future<void>; "
+                  "use all() instead");
+
+    std::promise<detail::collect_tuple_t<Args...>> p;
+
+    auto result = p.get_future();
+
+    executor->watch(std::make_unique<detail::CollectWithTuple<Args...>>(
+        std::move(timeLimit), std::move(futures), std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<Args...>> with the values of the input futures.
+template <typename... Args>
+std::future<detail::collect_tuple_t<Args...>> collect(std::shared_ptr<Executor> executor,
+                                                      std::tuple<std::future<Args>...> futures)
+{
+    return collect<Args...>(std::move(executor), std::chrono::hours(1), std::move(futures));
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The input futures as a tuple.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<Args...>> with the values of the input futures.
+template <typename... Args>
+std::future<detail::collect_tuple_t<Args...>> collect(std::chrono::microseconds timeLimit,
+                                                      std::tuple<std::future<Args>...> futures)
+{
+    return collect<Args...>(Default<Executor>(), std::move(timeLimit), std::move(futures));
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param futures The input futures as a tuple.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<Args...>> with the values of the input futures.
+template <typename... Args>
+std::future<detail::collect_tuple_t<Args...>> collect(std::tuple<std::future<Args>...> futures)
+{
+    return collect<Args...>(Default<Executor>(), std::chrono::hours(1), std::move(futures));
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \par The values are moved out of the ready futures in range [first, last), in
+//! order, into a single vector, while the resulting future is being dispatched. The
+//! Policy template parameter chooses what happens with the input futures that hold an
+//! exception (see #CollectPolicy). As with containers, a range of void futures results
+//! in an std::future<void>.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes
+//! ready. The input futures are left without a shared state.
+//!
+//! \sa all(), CollectPolicy, WaitableTimedOutException
+//!
+//! \return An std::future<std::vector> with the values of the input futures, or an
+//! std::future<void> for void input futures.
+template <CollectPolicy Policy = CollectPolicy::RethrowFirst, class TForwardIterator>
+collect_fwd_iterator_t<TForwardIterator> collect(std::shared_ptr<Executor> executor,
+                                                 std::chrono::microseconds timeLimit,
+                                                 TForwardIterator first,
+                                                 TForwardIterator last)
+{
+    std::promise<detail::collect_result_t<
+        detail::future_value_t<typename std::iterator_traits<TForwardIterator>::value_type>>>
+        p;
+
+    auto result = p.get_future();
+
+    executor->watch(std::make_unique<detail::CollectWithIterators<Policy, TForwardIterator>>(
+        std::move(timeLimit), first, last, std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes
+//! ready. The input futures are left without a shared state.
+//!
+//! \sa all(), CollectPolicy, WaitableTimedOutException
+//!
+//! \return An std::future<std::vector> with the values of the input futures, or an
+//! std::future<void> for void input futures.
+template <CollectPolicy Policy = CollectPolicy::RethrowFirst, class TForwardIterator>
+collect_fwd_iterator_t<TForwardIterator> collect(std::shared_ptr<Executor> executor,
+                                                 TForwardIterator first,
+                                                 TForwardIterator last)
+{
+    return collect<Policy, TForwardIterator>(std::move(executor),
+                                             std::chrono::hours(1),
+                                             first,
+                                             last);
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes
+//! ready. The input futures are left without a shared state.
+//!
+//! \sa all(), CollectPolicy, Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::vector> with the values of the input futures, or an
+//! std::future<void> for void input futures.
+template <CollectPolicy Policy = CollectPolicy::RethrowFirst, class TForwardIterator>
+collect_fwd_iterator_t<TForwardIterator> collect(std::chrono::microseconds timeLimit,
+                                                 TForwardIterator first,
+                                                 TForwardIterator last)
+{
+    return collect<Policy, TForwardIterator>(Default<Executor>(),
+                                             std::move(timeLimit),
+                                             first,
+                                             last);
+}
+
+//! \brief Creates a future that becomes ready with the values of all the input futures,
+//! when all of them become ready.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param first The first ForwardIterator of the range [first, last).
+//! \param last A ForwardIterator that marks the end of the range [first, last).
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \note The original containers, from which first and last are obtained, have to stay
+//! alive and stable (in the same memory address) until the resulting future becomes
+//! ready. The input futures are left without a shared state.
+//!
+//! \sa all(), CollectPolicy, Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::vector> with the values of the input futures, or an
+//! std::future<void> for void input futures.
+template <CollectPolicy Policy = CollectPolicy::RethrowFirst, class TForwardIterator>
+collect_fwd_iterator_t<TForwardIterator> collect(TForwardIterator first, TForwardIterator last)
+{
+    return collect<Policy, TForwardIterator>(Default<Executor>(),
+                                             std::chrono::hours(1),
+                                             first,
+                                             last);
+}
+
+} // namespace futures
+} // namespace thousandeyes
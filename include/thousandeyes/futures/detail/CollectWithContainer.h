@@ -0,0 +1,198 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <thousandeyes/futures/CollectPolicy.h>
+#include <thousandeyes/futures/detail/typetraits.h>
+#include <thousandeyes/futures/TimedWaitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Gathers the values of ready futures into a vector.
+template <class T>
+class ValueCollector {
+public:
+    using Result = std::vector<T>;
+
+    void reserve(std::size_t n)
+    {
+        values_.reserve(n);
+    }
+
+    template <class TFuture>
+    void add(TFuture& f)
+    {
+        values_.push_back(f.get());
+    }
+
+    Result result()
+    {
+        return std::move(values_);
+    }
+
+private:
+    std::vector<T> values_;
+};
+
+//! \brief Gets ready void futures, which have no value to gather.
+template <>
+class ValueCollector<void> {
+public:
+    using Result = void;
+
+    void reserve(std::size_t /* n */)
+    {}
+
+    template <class TFuture>
+    void add(TFuture& f)
+    {
+        f.get();
+    }
+
+    void result()
+    {}
+};
+
+//! \brief The type that collecting futures with values of type T results in: a vector
+//! of the values or, for void futures, void.
+template <class T>
+using collect_result_t = typename ValueCollector<T>::Result;
+
+//! \brief Moves the values of the given ready futures, in order, into a vector,
+//! rethrowing the first exception found.
+template <class T, class TForwardIterator>
+collect_result_t<T> collectValues(
+    TForwardIterator first,
+    TForwardIterator last,
+    std::integral_constant<CollectPolicy, CollectPolicy::RethrowFirst> /* policy */)
+{
+    ValueCollector<T> values;
+    values.reserve(std::distance(first, last));
+
+    for (; first != last; ++first) {
+        values.add(*first);
+    }
+
+    return values.result();
+}
+
+//! \brief Moves the values of the given ready futures, in order, into a vector,
+//! leaving out the ones that hold an exception.
+template <class T, class TForwardIterator>
+collect_result_t<T> collectValues(
+    TForwardIterator first,
+    TForwardIterator last,
+    std::integral_constant<CollectPolicy, CollectPolicy::SkipFailed> /* policy */)
+{
+    ValueCollector<T> values;
+    values.reserve(std::distance(first, last));
+
+    for (; first != last; ++first) {
+        try {
+            values.add(*first);
+        }
+        catch (...) {
+            // Skipped
+        }
+    }
+
+    return values.result();
+}
+
+//! \brief Sets the given promise to the collected values of the given ready futures.
+template <CollectPolicy Policy, class T, class TForwardIterator>
+void setCollectedValues(std::promise<std::vector<T>>& p,
+                        TForwardIterator first,
+                        TForwardIterator last)
+{
+    p.set_value(
+        collectValues<T>(first, last, std::integral_constant<CollectPolicy, Policy>{}));
+}
+
+//! \brief Sets the given promise once the given ready void futures are collected.
+template <CollectPolicy Policy, class TForwardIterator>
+void setCollectedValues(std::promise<void>& p, TForwardIterator first, TForwardIterator last)
+{
+    collectValues<void>(first, last, std::integral_constant<CollectPolicy, Policy>{});
+    p.set_value();
+}
+
+//! \brief Waits for all the futures in the container and collects their values.
+//!
+//! \par Like #FutureWithContainer, the futures are checked in order and the ones that
+//! are found ready are not checked again.
+template <CollectPolicy Policy, class TContainer>
+class CollectWithContainer : public TimedWaitable {
+public:
+    using Container = typename std::decay<TContainer>::type;
+    using Value = future_value_t<typename Container::value_type>;
+
+    CollectWithContainer(std::chrono::microseconds waitLimit,
+                         TContainer&& futures,
+                         std::promise<collect_result_t<Value>> p) :
+        TimedWaitable(std::move(waitLimit)),
+        futures_(std::forward<TContainer>(futures)),
+        next_(futures_.begin()),
+        p_(std::move(p))
+    {}
+
+    CollectWithContainer(const CollectWithContainer& o) = delete;
+    CollectWithContainer& operator=(const CollectWithContainer& o) = delete;
+
+    // Not movable, since next_ points into futures_
+    CollectWithContainer(CollectWithContainer&& o) = delete;
+    CollectWithContainer& operator=(CollectWithContainer&& o) = delete;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        for (; next_ != futures_.end(); ++next_) {
+            if (next_->wait_until(deadline) != std::future_status::ready) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err) {
+            p_.set_exception(err);
+            return;
+        }
+
+        try {
+            setCollectedValues<Policy>(p_, futures_.begin(), futures_.end());
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    Container futures_;
+    typename Container::iterator next_;
+    std::promise<collect_result_t<Value>> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
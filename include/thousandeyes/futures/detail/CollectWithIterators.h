@@ -0,0 +1,86 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <vector>
+
+#include <thousandeyes/futures/detail/CollectWithContainer.h>
+#include <thousandeyes/futures/TimedWaitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Waits for all the futures in the range and collects their values.
+//!
+//! \par Like #FutureWithIterators, the futures are checked in order and the ones that
+//! are found ready are not checked again.
+template <CollectPolicy Policy, class TForwardIterator>
+class CollectWithIterators : public TimedWaitable {
+public:
+    using Value = future_value_t<typename std::iterator_traits<TForwardIterator>::value_type>;
+
+    CollectWithIterators(std::chrono::microseconds waitLimit,
+                         TForwardIterator firstIter,
+                         TForwardIterator lastIter,
+                         std::promise<collect_result_t<Value>> p) :
+        TimedWaitable(std::move(waitLimit)),
+        first_(firstIter),
+        last_(lastIter),
+        next_(firstIter),
+        p_(std::move(p))
+    {}
+
+    CollectWithIterators(const CollectWithIterators& o) = delete;
+    CollectWithIterators& operator=(const CollectWithIterators& o) = delete;
+
+    CollectWithIterators(CollectWithIterators&& o) = default;
+    CollectWithIterators& operator=(CollectWithIterators&& o) = default;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        for (; next_ != last_; ++next_) {
+            if (next_->wait_until(deadline) != std::future_status::ready) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err) {
+            p_.set_exception(err);
+            return;
+        }
+
+        try {
+            setCollectedValues<Policy>(p_, first_, last_);
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    TForwardIterator first_;
+    TForwardIterator last_;
+    TForwardIterator next_;
+    std::promise<collect_result_t<Value>> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
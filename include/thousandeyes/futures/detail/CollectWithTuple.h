@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <thousandeyes/futures/detail/FutureWithTuple.h>
+#include <thousandeyes/futures/TimedWaitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief The tuple of the values of the given types or, if any of them is void, which
+//! cannot be held in a tuple, void.
+template <typename... Args>
+using collect_tuple_t = typename std::conditional<
+    std::disjunction<std::is_void<Args>...>::value, void, std::tuple<Args...>>::type;
+
+//! \brief Waits for all the futures in the tuple and collects their values into a
+//! tuple, failing with the first exception in the order of the tuple.
+//!
+//! \par Like #FutureWithTuple, the futures are checked in order and the ones that
+//! are found ready are not checked again.
+template <typename... Args>
+class CollectWithTuple : public TimedWaitable {
+public:
+    CollectWithTuple(std::chrono::microseconds waitLimit,
+                     std::tuple<std::future<Args>...> futures,
+                     std::promise<std::tuple<Args...>> p) :
+        TimedWaitable(std::move(waitLimit)),
+        futures_(std::move(futures)),
+        p_(std::move(p))
+    {}
+
+    CollectWithTuple(const CollectWithTuple& o) = delete;
+    CollectWithTuple& operator=(const CollectWithTuple& o) = delete;
+
+    CollectWithTuple(CollectWithTuple&& o) = default;
+    CollectWithTuple& operator=(CollectWithTuple&& o) = default;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        return TupleItemsWaitUntil<0, sizeof...(Args)>()(futures_, next_, deadline);
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err) {
+            p_.set_exception(err);
+            return;
+        }
+
+        try {
+            p_.set_value(collect_(std::index_sequence_for<Args...>{}));
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    template <std::size_t... Is>
+    std::tuple<Args...> collect_(std::index_sequence<Is...>)
+    {
+        // The elements of a braced-init-list are evaluated in order
+        return std::tuple<Args...>{std::get<Is>(futures_).get()...};
+    }
+
+    std::tuple<std::future<Args>...> futures_;
+    std::size_t next_{0};
+    std::promise<std::tuple<Args...>> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
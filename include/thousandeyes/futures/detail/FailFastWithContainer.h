@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <thousandeyes/futures/TimedWaitable.h>
+#include <thousandeyes/futures/detail/settle.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Waits for all the futures in the container, unless one of them becomes
+//! ready with an exception, in which case the remaining ones are not waited for.
+template <class TContainer>
+class FailFastWithContainer : public TimedWaitable {
+public:
+    FailFastWithContainer(std::chrono::microseconds waitLimit,
+                          TContainer&& futures,
+                          std::promise<typename std::decay<TContainer>::type> p) :
+        TimedWaitable(std::move(waitLimit)),
+        futures_(std::forward<TContainer>(futures)),
+        p_(std::move(p))
+    {
+        for (auto iter = futures_.begin(); iter != futures_.end(); ++iter) {
+            pending_.push_back(iter);
+        }
+    }
+
+    FailFastWithContainer(const FailFastWithContainer& o) = delete;
+    FailFastWithContainer& operator=(const FailFastWithContainer& o) = delete;
+
+    // Not movable, since pending_ points into futures_
+    FailFastWithContainer(FailFastWithContainer&& o) = delete;
+    FailFastWithContainer& operator=(FailFastWithContainer&& o) = delete;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        if (error_) {
+            return true;
+        }
+
+        error_ = settleUntil(pending_, std::chrono::steady_clock::now() + timeout);
+        return error_ || pending_.empty();
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err || error_) {
+            p_.set_exception(err ? err : error_);
+            return;
+        }
+
+        try {
+            p_.set_value(std::move(futures_));
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    using Container = typename std::decay<TContainer>::type;
+
+    Container futures_;
+    std::vector<typename Container::iterator> pending_;
+    std::exception_ptr error_;
+    std::promise<Container> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
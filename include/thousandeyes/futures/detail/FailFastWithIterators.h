@@ -0,0 +1,82 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <exception>
+#include <future>
+#include <tuple>
+#include <vector>
+
+#include <thousandeyes/futures/TimedWaitable.h>
+#include <thousandeyes/futures/detail/settle.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Waits for all the futures in the range, unless one of them becomes
+//! ready with an exception, in which case the remaining ones are not waited for.
+template <class TForwardIterator>
+class FailFastWithIterators : public TimedWaitable {
+public:
+    FailFastWithIterators(std::chrono::microseconds waitLimit,
+                          TForwardIterator firstIter,
+                          TForwardIterator lastIter,
+                          std::promise<std::tuple<TForwardIterator, TForwardIterator>> p) :
+        TimedWaitable(std::move(waitLimit)),
+        range_(firstIter, lastIter),
+        p_(std::move(p))
+    {
+        for (; firstIter != lastIter; ++firstIter) {
+            pending_.push_back(firstIter);
+        }
+    }
+
+    FailFastWithIterators(const FailFastWithIterators& o) = delete;
+    FailFastWithIterators& operator=(const FailFastWithIterators& o) = delete;
+
+    FailFastWithIterators(FailFastWithIterators&& o) = default;
+    FailFastWithIterators& operator=(FailFastWithIterators&& o) = default;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        if (error_) {
+            return true;
+        }
+
+        error_ = settleUntil(pending_, std::chrono::steady_clock::now() + timeout);
+        return error_ || pending_.empty();
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err || error_) {
+            p_.set_exception(err ? err : error_);
+            return;
+        }
+
+        try {
+            p_.set_value(std::move(range_));
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    std::tuple<TForwardIterator, TForwardIterator> range_;
+    std::vector<TForwardIterator> pending_;
+    std::exception_ptr error_;
+    std::promise<std::tuple<TForwardIterator, TForwardIterator>> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
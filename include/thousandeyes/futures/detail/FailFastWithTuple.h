@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <tuple>
+#include <utility>
+
+#include <thousandeyes/futures/TimedWaitable.h>
+#include <thousandeyes/futures/detail/settle.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Settles the tuple's futures that are not settled yet and that become
+//! ready until the given deadline, stopping at the first exception.
+//!
+//! \return true if all the futures are settled or if an exception was found.
+template <std::size_t I, std::size_t N>
+struct TupleItemsSettleUntil {
+    template <class T, class TTimePoint>
+    bool operator()(T& t,
+                    std::array<bool, N>& settled,
+                    std::exception_ptr& error,
+                    const TTimePoint& deadline) const
+    {
+        if (!settled[I] && std::get<I>(t).wait_until(deadline) == std::future_status::ready) {
+            settled[I] = true;
+            error = settle(std::get<I>(t));
+            if (error) {
+                return true;
+            }
+        }
+
+        const bool isRestSettled = TupleItemsSettleUntil<I + 1, N>()(t, settled, error, deadline);
+        return error || (settled[I] && isRestSettled);
+    }
+};
+
+template <std::size_t N>
+struct TupleItemsSettleUntil<N, N> {
+    template <class T, class TTimePoint>
+    bool operator()(T& /* t */,
+                    std::array<bool, N>& /* settled */,
+                    std::exception_ptr& /* error */,
+                    const TTimePoint& /* deadline */) const
+    {
+        return true;
+    }
+};
+
+//! \brief Waits for all the futures in the tuple, unless one of them becomes
+//! ready with an exception, in which case the remaining ones are not waited for.
+template <typename... Args>
+class FailFastWithTuple : public TimedWaitable {
+public:
+    FailFastWithTuple(std::chrono::microseconds waitLimit,
+                      std::tuple<std::future<Args>...> futures,
+                      std::promise<std::tuple<std::future<Args>...>> p) :
+        TimedWaitable(std::move(waitLimit)),
+        futures_(std::move(futures)),
+        p_(std::move(p))
+    {}
+
+    FailFastWithTuple(const FailFastWithTuple& o) = delete;
+    FailFastWithTuple& operator=(const FailFastWithTuple& o) = delete;
+
+    FailFastWithTuple(FailFastWithTuple&& o) = default;
+    FailFastWithTuple& operator=(FailFastWithTuple&& o) = default;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        if (error_) {
+            return true;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        return TupleItemsSettleUntil<0, sizeof...(Args)>()(futures_, settled_, error_, deadline);
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err || error_) {
+            p_.set_exception(err ? err : error_);
+            return;
+        }
+
+        try {
+            p_.set_value(std::move(futures_));
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    std::tuple<std::future<Args>...> futures_;
+    std::array<bool, sizeof...(Args)> settled_{};
+    std::exception_ptr error_;
+    std::promise<std::tuple<std::future<Args>...>> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
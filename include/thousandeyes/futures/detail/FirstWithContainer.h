@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+#include <thousandeyes/futures/TimedWaitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Waits for the first of the futures in the container to become ready.
+//!
+//! \par Every poll checks all the futures without blocking and, only if none of them
+//! is ready, waits for one of them until the given timeout expires. The future that
+//! is waited for rotates across polls, so that a future that never becomes ready
+//! does not hide the readiness of the others. An empty container is ready right
+//! away, with an index equal to its size.
+template <class TContainer>
+class FirstWithContainer : public TimedWaitable {
+public:
+    using Container = typename std::decay<TContainer>::type;
+
+    FirstWithContainer(std::chrono::microseconds waitLimit,
+                       TContainer&& futures,
+                       std::promise<std::tuple<std::size_t, Container>> p) :
+        TimedWaitable(std::move(waitLimit)),
+        futures_(std::forward<TContainer>(futures)),
+        p_(std::move(p))
+    {}
+
+    FirstWithContainer(const FirstWithContainer& o) = delete;
+    FirstWithContainer& operator=(const FirstWithContainer& o) = delete;
+
+    FirstWithContainer(FirstWithContainer&& o) = default;
+    FirstWithContainer& operator=(FirstWithContainer&& o) = default;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        index_ = 0;
+        for (const auto& f : futures_) {
+            if (f.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                return true;
+            }
+            ++index_;
+        }
+
+        if (index_ == 0) {
+            return true;
+        }
+
+        index_ = nextWait_++ % index_;
+        return std::next(futures_.begin(), index_)->wait_for(timeout) ==
+               std::future_status::ready;
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err) {
+            p_.set_exception(err);
+            return;
+        }
+
+        try {
+            p_.set_value(std::make_tuple(index_, std::move(futures_)));
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    Container futures_;
+    std::size_t index_{0};
+    std::size_t nextWait_{0};
+    std::promise<std::tuple<std::size_t, Container>> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <tuple>
+
+#include <thousandeyes/futures/TimedWaitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Waits for the first of the futures in the range to become ready.
+//!
+//! \par Every poll checks all the futures without blocking and, only if none of them
+//! is ready, waits for one of them until the given timeout expires. The future that
+//! is waited for rotates across polls, so that a future that never becomes ready
+//! does not hide the readiness of the others. An empty range is ready right away,
+//! with an index of 0 and the range's end as the winner.
+template <class TForwardIterator>
+class FirstWithIterators : public TimedWaitable {
+public:
+    FirstWithIterators(std::chrono::microseconds waitLimit,
+                       TForwardIterator firstIter,
+                       TForwardIterator lastIter,
+                       std::promise<std::tuple<std::size_t, TForwardIterator>> p) :
+        TimedWaitable(std::move(waitLimit)),
+        first_(firstIter),
+        last_(lastIter),
+        winner_(firstIter),
+        p_(std::move(p))
+    {}
+
+    FirstWithIterators(const FirstWithIterators& o) = delete;
+    FirstWithIterators& operator=(const FirstWithIterators& o) = delete;
+
+    FirstWithIterators(FirstWithIterators&& o) = default;
+    FirstWithIterators& operator=(FirstWithIterators&& o) = default;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        index_ = 0;
+        for (winner_ = first_; winner_ != last_; ++winner_, ++index_) {
+            if (winner_->wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                return true;
+            }
+        }
+
+        if (first_ == last_) {
+            return true;
+        }
+
+        index_ = nextWait_++ % index_;
+        winner_ = std::next(first_, index_);
+        return winner_->wait_for(timeout) == std::future_status::ready;
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err) {
+            p_.set_exception(err);
+            return;
+        }
+
+        try {
+            p_.set_value(std::make_tuple(index_, winner_));
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    TForwardIterator first_;
+    TForwardIterator last_;
+    TForwardIterator winner_;
+    std::size_t index_{0};
+    std::size_t nextWait_{0};
+    std::promise<std::tuple<std::size_t, TForwardIterator>> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
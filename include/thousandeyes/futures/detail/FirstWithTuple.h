@@ -0,0 +1,134 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <tuple>
+#include <utility>
+
+#include <thousandeyes/futures/TimedWaitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Finds the index of the first of the tuple's futures that is ready,
+//! without blocking.
+//!
+//! \return The index of the ready future, or N if none of the futures is ready.
+template <std::size_t I, std::size_t N>
+struct TupleItemsFindReady {
+    template <class T>
+    std::size_t operator()(const T& t) const
+    {
+        if (std::get<I>(t).wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            return I;
+        }
+        return TupleItemsFindReady<I + 1, N>()(t);
+    }
+};
+
+template <std::size_t N>
+struct TupleItemsFindReady<N, N> {
+    template <class T>
+    std::size_t operator()(const T& /* t */) const
+    {
+        return N;
+    }
+};
+
+//! \brief Waits for the tuple's future at the given index until the timeout expires.
+//!
+//! \return true if the future became ready.
+template <std::size_t I, std::size_t N>
+struct TupleItemWaitFor {
+    template <class T>
+    bool operator()(const T& t, std::size_t index, const std::chrono::microseconds& timeout) const
+    {
+        if (index == I) {
+            return std::get<I>(t).wait_for(timeout) == std::future_status::ready;
+        }
+        return TupleItemWaitFor<I + 1, N>()(t, index, timeout);
+    }
+};
+
+template <std::size_t N>
+struct TupleItemWaitFor<N, N> {
+    template <class T>
+    bool operator()(const T& /* t */,
+                    std::size_t /* index */,
+                    const std::chrono::microseconds& /* timeout */) const
+    {
+        return false;
+    }
+};
+
+//! \brief Waits for the first of the futures in the tuple to become ready.
+//!
+//! \par Every poll checks all the futures without blocking and, only if none of them
+//! is ready, waits for one of them until the given timeout expires. The future that
+//! is waited for rotates across polls, so that a future that never becomes ready
+//! does not hide the readiness of the others.
+template <typename... Args>
+class FirstWithTuple : public TimedWaitable {
+public:
+    static_assert(sizeof...(Args) > 0, "At least one future is required");
+
+    FirstWithTuple(std::chrono::microseconds waitLimit,
+                   std::tuple<std::future<Args>...> futures,
+                   std::promise<std::tuple<std::size_t, std::tuple<std::future<Args>...>>> p) :
+        TimedWaitable(std::move(waitLimit)),
+        futures_(std::move(futures)),
+        p_(std::move(p))
+    {}
+
+    FirstWithTuple(const FirstWithTuple& o) = delete;
+    FirstWithTuple& operator=(const FirstWithTuple& o) = delete;
+
+    FirstWithTuple(FirstWithTuple&& o) = default;
+    FirstWithTuple& operator=(FirstWithTuple&& o) = default;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        index_ = TupleItemsFindReady<0, sizeof...(Args)>()(futures_);
+        if (index_ < sizeof...(Args)) {
+            return true;
+        }
+
+        index_ = nextWait_++ % sizeof...(Args);
+        return TupleItemWaitFor<0, sizeof...(Args)>()(futures_, index_, timeout);
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err) {
+            p_.set_exception(err);
+            return;
+        }
+
+        try {
+            p_.set_value(std::make_tuple(index_, std::move(futures_)));
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    std::tuple<std::future<Args>...> futures_;
+    std::size_t index_{0};
+    std::size_t nextWait_{0};
+    std::promise<std::tuple<std::size_t, std::tuple<std::future<Args>...>>> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
@@ -15,12 +15,25 @@
 
 #include <thousandeyes/futures/detail/FutureWithForwarding.h>
 #include <thousandeyes/futures/Executor.h>
+#include <thousandeyes/futures/Promise.h>
 #include <thousandeyes/futures/TimedWaitable.h>
 
 namespace thousandeyes {
 namespace futures {
 namespace detail {
 
+//! \brief Invokes a continuation that returns a future and forwards that future's
+//! outcome to the promise of the future that was returned to the caller.
+//!
+//! \par If the returned future is already ready (e.g., it comes from fromValue() at
+//! the base of a recursion), its outcome is forwarded right away. If it is a #Future,
+//! a #FutureWithForwarding is subscribed to its ready signal, so that it is handed to
+//! the executor as soon as the associated #Promise is satisfied, without being polled
+//! and without a time limit. Otherwise, a #FutureWithForwarding is watched for it.
+//!
+//! \note Each pending level of a chain still gets its own #FutureWithForwarding: the
+//! executor releases a #Waitable once it dispatches it, so the chaining #Waitable
+//! cannot be handed back to the executor to do the forwarding itself.
 template <class TIn, class TOut, class TFunc>
 class FutureWithChaining : public TimedWaitable {
 public:
@@ -55,14 +68,18 @@ public:
         }
 
         try {
-            if (auto e = executor_.lock()) {
-                e->watch(std::make_unique<FutureWithForwarding<TOut>>(getTimeout(),
-                                                                      cont_(std::move(f_)),
-                                                                      std::move(p_)));
-            }
-            else {
+            auto e = executor_.lock();
+            if (!e) {
                 throw WaitableWaitException("No executor available");
             }
+
+            auto g = cont_(std::move(f_));
+            if (g.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                forwardReady(g, p_);
+                return;
+            }
+
+            forward_(std::move(e), std::move(g));
         }
         catch (...) {
             p_.set_exception(std::current_exception());
@@ -70,6 +87,22 @@ public:
     }
 
 private:
+    void forward_(std::shared_ptr<Executor> e, std::future<TOut> g)
+    {
+        e->watch(std::make_unique<FutureWithForwarding<TOut>>(getTimeout(),
+                                                              std::move(g),
+                                                              std::move(p_)));
+    }
+
+    void forward_(std::shared_ptr<Executor> e, Future<TOut> g)
+    {
+        auto signal = g.readySignal();
+        signal->subscribe(std::move(e),
+                          std::make_unique<FutureWithForwarding<TOut>>(getTimeout(),
+                                                                       std::move(g),
+                                                                       std::move(p_)));
+    }
+
     std::weak_ptr<Executor> executor_;
     std::future<TIn> f_;
     std::promise<TOut> p_;
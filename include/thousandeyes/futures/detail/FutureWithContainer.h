@@ -10,8 +10,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <future>
 #include <memory>
+#include <type_traits>
 
 #include <thousandeyes/futures/TimedWaitable.h>
 
@@ -19,6 +21,9 @@ namespace thousandeyes {
 namespace futures {
 namespace detail {
 
+//! \note The futures in the container are checked in order and the ones that are
+//! found ready are not checked again, so each poll resumes from the first future
+//! that was not ready, spending at most the given timeout on the whole container.
 template <class TContainer>
 class FutureWithContainer : public TimedWaitable {
 public:
@@ -27,19 +32,23 @@ public:
                         std::promise<typename std::decay<TContainer>::type> p) :
         TimedWaitable(std::move(waitLimit)),
         futures_(std::forward<TContainer>(futures)),
+        next_(futures_.begin()),
         p_(std::move(p))
     {}
 
     FutureWithContainer(const FutureWithContainer& o) = delete;
     FutureWithContainer& operator=(const FutureWithContainer& o) = delete;
 
-    FutureWithContainer(FutureWithContainer&& o) = default;
-    FutureWithContainer& operator=(FutureWithContainer&& o) = default;
+    // Not movable, since next_ points into futures_
+    FutureWithContainer(FutureWithContainer&& o) = delete;
+    FutureWithContainer& operator=(FutureWithContainer&& o) = delete;
 
     bool timedWait(const std::chrono::microseconds& timeout) override
     {
-        for (const auto& f : futures_) {
-            if (f.wait_for(timeout) != std::future_status::ready) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        for (; next_ != futures_.end(); ++next_) {
+            if (next_->wait_until(deadline) != std::future_status::ready) {
                 return false;
             }
         }
@@ -63,6 +72,7 @@ public:
 
 private:
     typename std::decay<TContainer>::type futures_;
+    typename std::decay<TContainer>::type::iterator next_;
     std::promise<typename std::decay<TContainer>::type> p_;
 };
 
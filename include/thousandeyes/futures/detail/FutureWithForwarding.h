@@ -19,6 +19,30 @@ namespace thousandeyes {
 namespace futures {
 namespace detail {
 
+//! \brief Moves the value or the exception of the given ready future into the given promise.
+template <class T>
+void forwardReady(std::future<T>& f, std::promise<T>& p)
+{
+    try {
+        p.set_value(f.get());
+    }
+    catch (...) {
+        p.set_exception(std::current_exception());
+    }
+}
+
+//! \brief Moves the outcome of the given ready void future into the given promise.
+inline void forwardReady(std::future<void>& f, std::promise<void>& p)
+{
+    try {
+        f.get();
+        p.set_value();
+    }
+    catch (...) {
+        p.set_exception(std::current_exception());
+    }
+}
+
 template <class T>
 class FutureWithForwarding : public TimedWaitable {
 public:
@@ -46,12 +70,7 @@ public:
             return;
         }
 
-        try {
-            p_.set_value(f_.get());
-        }
-        catch (...) {
-            p_.set_exception(std::current_exception());
-        }
+        forwardReady(f_, p_);
     }
 
 private:
@@ -90,13 +109,7 @@ public:
             return;
         }
 
-        try {
-            f_.get();
-            p_.set_value();
-        }
-        catch (...) {
-            p_.set_exception(std::current_exception());
-        }
+        forwardReady(f_, p_);
     }
 
 private:
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <future>
 #include <tuple>
 
@@ -19,6 +20,9 @@ namespace thousandeyes {
 namespace futures {
 namespace detail {
 
+//! \note The futures in the range are checked in order and the ones that are
+//! found ready are not checked again, so each poll resumes from the first future
+//! that was not ready, spending at most the given timeout on the whole range.
 template <class TForwardIterator>
 class FutureWithIterators : public TimedWaitable {
 public:
@@ -28,6 +32,7 @@ public:
                         std::promise<std::tuple<TForwardIterator, TForwardIterator>> p) :
         TimedWaitable(std::move(waitLimit)),
         range_(firstIter, lastIter),
+        next_(firstIter),
         p_(std::move(p))
     {}
 
@@ -39,9 +44,11 @@ public:
 
     bool timedWait(const std::chrono::microseconds& timeout) override
     {
-        TForwardIterator end = std::get<1>(range_);
-        for (TForwardIterator iter = std::get<0>(range_); iter != end; ++iter) {
-            if (iter->wait_for(timeout) != std::future_status::ready) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        const TForwardIterator& end = std::get<1>(range_);
+        for (; next_ != end; ++next_) {
+            if (next_->wait_until(deadline) != std::future_status::ready) {
                 return false;
             }
         }
@@ -65,6 +72,7 @@ public:
 
 private:
     std::tuple<TForwardIterator, TForwardIterator> range_;
+    TForwardIterator next_;
     std::promise<std::tuple<TForwardIterator, TForwardIterator>> p_;
 };
 
@@ -0,0 +1,350 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <thousandeyes/futures/detail/FutureWithForwarding.h>
+#include <thousandeyes/futures/detail/typetraits.h>
+#include <thousandeyes/futures/Executor.h>
+#include <thousandeyes/futures/TimedWaitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief The outcome of a pipeline stage that is handed to the next stage in place,
+//! instead of in a ready future: either a value or an exception.
+template <class T>
+struct StageOutcome {
+    std::optional<T> value;
+    std::exception_ptr error;
+};
+
+template <>
+struct StageOutcome<void> {
+    std::exception_ptr error;
+};
+
+//! \brief Whether the stage takes its input as an std::future<T>, like a continuation
+//! passed to then(), rather than as a plain value.
+template <class T, class TFunc>
+struct stage_takes_future : std::is_invocable<TFunc&, std::future<T>> {};
+
+//! \brief The type that a pipeline stage returns when it is invoked on the outcome
+//! of a std::future<T>.
+template <class T, class TFunc, bool = stage_takes_future<T, TFunc>::value>
+struct stage_result {
+    using type = std::invoke_result_t<TFunc&, std::future<T>>;
+};
+
+template <class T, class TFunc>
+struct stage_result<T, TFunc, false> {
+    using type = std::invoke_result_t<TFunc&, T>;
+};
+
+template <class TFunc>
+struct stage_result<void, TFunc, false> {
+    using type = std::invoke_result_t<TFunc&>;
+};
+
+template <class T, class TFunc>
+using stage_result_t = typename stage_result<T, TFunc>::type;
+
+//! \brief The value type of the future that a pipeline stage produces on a
+//! std::future<TIn>, whether the stage returns a value or a future.
+template <class TIn, class TFunc, class = void>
+struct stage_output {
+    using type = stage_result_t<TIn, TFunc>;
+};
+
+template <class TIn, class TFunc>
+struct stage_output<TIn,
+                    TFunc,
+                    typename std::enable_if<is_future<stage_result_t<TIn, TFunc>>::value>::type> {
+    using type = typename nth_template_param<0, stage_result_t<TIn, TFunc>>::type;
+};
+
+//! \brief The value type of the future that a pipeline of the given stages produces
+//! on a std::future<TIn>.
+template <class TIn, class... TStages>
+struct pipeline_output {
+    using type = TIn;
+};
+
+template <class TIn, class TStage, class... TRest>
+struct pipeline_output<TIn, TStage, TRest...> {
+    using type = typename pipeline_output<typename stage_output<TIn, TStage>::type, TRest...>::type;
+};
+
+//! \brief Invokes the given function and keeps its value or exception.
+template <class T, class TCall>
+StageOutcome<T> captureStage(TCall& call, std::false_type /* isVoid */)
+{
+    StageOutcome<T> out;
+    try {
+        out.value.emplace(call());
+    }
+    catch (...) {
+        out.error = std::current_exception();
+    }
+    return out;
+}
+
+template <class T, class TCall>
+StageOutcome<T> captureStage(TCall& call, std::true_type /* isVoid */)
+{
+    StageOutcome<T> out;
+    try {
+        call();
+    }
+    catch (...) {
+        out.error = std::current_exception();
+    }
+    return out;
+}
+
+//! \brief Takes the outcome of the given ready future.
+template <class T>
+StageOutcome<T> toStageOutcome(std::future<T> f)
+{
+    auto call = [&f]() -> decltype(auto) { return f.get(); };
+    return captureStage<T>(call, std::is_void<T>{});
+}
+
+template <class T>
+StageOutcome<T> toStageOutcome(StageOutcome<T> outcome)
+{
+    return outcome;
+}
+
+//! \brief Sets the given promise to the outcome of the last stage.
+template <class T>
+void completeStage(std::promise<T>& p, std::future<T> f)
+{
+    forwardReady(f, p);
+}
+
+template <class T>
+void completeStage(std::promise<T>& p, StageOutcome<T> outcome)
+{
+    if (outcome.error) {
+        p.set_exception(std::move(outcome.error));
+        return;
+    }
+    p.set_value(std::move(*outcome.value));
+}
+
+inline void completeStage(std::promise<void>& p, StageOutcome<void> outcome)
+{
+    if (outcome.error) {
+        p.set_exception(std::move(outcome.error));
+        return;
+    }
+    p.set_value();
+}
+
+template <class T>
+std::future<T> toStageFuture(std::future<T> f)
+{
+    return f;
+}
+
+//! \brief Wraps the given outcome in a ready future, which allocates its shared state.
+template <class T>
+std::future<T> toStageFuture(StageOutcome<T> outcome)
+{
+    std::promise<T> p;
+    completeStage(p, std::move(outcome));
+    return p.get_future();
+}
+
+//! \brief Invokes a stage that takes a plain value on the given successful outcome.
+template <class TStage, class T>
+decltype(auto) applyStage(TStage& stage, StageOutcome<T>& arg)
+{
+    return stage(std::move(*arg.value));
+}
+
+template <class TStage>
+decltype(auto) applyStage(TStage& stage, StageOutcome<void>& /* arg */)
+{
+    return stage();
+}
+
+//! \brief Waits for a future and invokes a sequence of continuations (stages) on it,
+//! each one on the outcome of the previous one, as if they were attached one after
+//! the other with then().
+//!
+//! \par The stages run one after the other within the same dispatch, until one
+//! returns a future that is not ready yet; the rest of the stages are then moved into
+//! a new FutureWithPipeline that waits for that future. A stage that takes a plain
+//! value gets the previous stage's value in place, and is skipped, along with its
+//! exception, if the previous stage failed. Only a stage that takes an std::future
+//! gets a previous stage's value wrapped in a ready future, whose shared state is
+//! allocated. The resulting promise is set once, by the last stage.
+template <class TIn, class TOut, class... TStages>
+class FutureWithPipeline : public TimedWaitable {
+public:
+    FutureWithPipeline(std::chrono::microseconds waitLimit,
+                       std::weak_ptr<Executor> executor,
+                       std::future<TIn> f,
+                       std::promise<TOut> p,
+                       std::tuple<TStages...> stages) :
+        TimedWaitable(std::move(waitLimit)),
+        executor_(std::move(executor)),
+        f_(std::move(f)),
+        p_(std::move(p)),
+        stages_(std::move(stages))
+    {}
+
+    FutureWithPipeline(const FutureWithPipeline& o) = delete;
+    FutureWithPipeline& operator=(const FutureWithPipeline& o) = delete;
+
+    FutureWithPipeline(FutureWithPipeline&& o) = default;
+    FutureWithPipeline& operator=(FutureWithPipeline&& o) = default;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        return f_.wait_for(timeout) == std::future_status::ready;
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err) {
+            p_.set_exception(err);
+            return;
+        }
+
+        try {
+            run_<0>(std::move(f_));
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    static constexpr std::size_t kStages = sizeof...(TStages);
+
+    template <std::size_t I>
+    using Stage = typename std::tuple_element<I, std::tuple<TStages...>>::type;
+
+    // The input of a stage is either a ready std::future or a StageOutcome
+    template <std::size_t I, template <class> class TInput, class T>
+    void run_(TInput<T> in)
+    {
+        run_<I>(std::move(in), std::integral_constant<bool, I == kStages>{});
+    }
+
+    template <std::size_t I, template <class> class TInput, class T>
+    void run_(TInput<T> in, std::true_type /* isDone */)
+    {
+        completeStage(p_, std::move(in));
+    }
+
+    template <std::size_t I, template <class> class TInput, class T>
+    void run_(TInput<T> in, std::false_type /* isDone */)
+    {
+        invokeStage_<I>(std::move(in),
+                        stage_takes_future<T, Stage<I>>{},
+                        is_future<stage_result_t<T, Stage<I>>>{});
+    }
+
+    template <std::size_t I, template <class> class TInput, class T, class TReturnsFuture>
+    void invokeStage_(TInput<T> in, std::true_type /* takesFuture */, TReturnsFuture returnsFuture)
+    {
+        auto f = toStageFuture(std::move(in));
+        auto call = [this, &f]() -> decltype(auto) { return std::get<I>(stages_)(std::move(f)); };
+
+        finishStage_<I, typename stage_output<T, Stage<I>>::type>(call, returnsFuture);
+    }
+
+    template <std::size_t I, template <class> class TInput, class T, class TReturnsFuture>
+    void invokeStage_(TInput<T> in, std::false_type /* takesFuture */, TReturnsFuture returnsFuture)
+    {
+        using TNext = typename stage_output<T, Stage<I>>::type;
+
+        auto arg = toStageOutcome(std::move(in));
+        if (arg.error) {
+            StageOutcome<TNext> out;
+            out.error = std::move(arg.error);
+            run_<I + 1>(std::move(out));
+            return;
+        }
+
+        auto call = [this, &arg]() -> decltype(auto) {
+            return applyStage(std::get<I>(stages_), arg);
+        };
+
+        finishStage_<I, TNext>(call, returnsFuture);
+    }
+
+    template <std::size_t I, class TNext, class TCall>
+    void finishStage_(TCall& call, std::false_type /* returnsFuture */)
+    {
+        run_<I + 1>(captureStage<TNext>(call, std::is_void<TNext>{}));
+    }
+
+    template <std::size_t I, class TNext, class TCall>
+    void finishStage_(TCall& call, std::true_type /* returnsFuture */)
+    {
+        std::future<TNext> next;
+        try {
+            next = call();
+        }
+        catch (...) {
+            StageOutcome<TNext> out;
+            out.error = std::current_exception();
+            run_<I + 1>(std::move(out));
+            return;
+        }
+
+        if (next.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            run_<I + 1>(std::move(next));
+            return;
+        }
+
+        watchRest_<I + 1>(std::move(next), std::make_index_sequence<kStages - I - 1>{});
+    }
+
+    template <std::size_t I, class TNext, std::size_t... Js>
+    void watchRest_(std::future<TNext> next, std::index_sequence<Js...>)
+    {
+        using Rest = FutureWithPipeline<TNext, TOut, Stage<I + Js>...>;
+
+        auto e = executor_.lock();
+        if (!e) {
+            throw WaitableWaitException("No executor available");
+        }
+
+        e->watch(std::make_unique<Rest>(getTimeout(),
+                                        executor_,
+                                        std::move(next),
+                                        std::move(p_),
+                                        std::make_tuple(std::move(std::get<I + Js>(stages_))...)));
+    }
+
+    std::weak_ptr<Executor> executor_;
+    std::future<TIn> f_;
+    std::promise<TOut> p_;
+    std::tuple<TStages...> stages_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <thousandeyes/futures/TimedWaitable.h>
+#include <thousandeyes/futures/detail/settle.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Waits for a given number of the futures in the container to become ready
+//! with a value.
+//!
+//! \par The futures that are found ready are settled and not checked again: the ones
+//! that hold an exception are set aside and do not count towards the quorum. Once
+//! enough of them succeed, the rest are not waited for; once too many of them fail
+//! for the quorum to be reached, the waitable fails with the last exception found.
+template <class TContainer>
+class FutureWithQuorum : public TimedWaitable {
+public:
+    using Container = typename std::decay<TContainer>::type;
+    using Future = typename Container::value_type;
+    using Result = std::tuple<std::vector<Future>, std::vector<Future>, std::vector<Future>>;
+
+    FutureWithQuorum(std::chrono::microseconds waitLimit,
+                     std::size_t quorum,
+                     TContainer&& futures,
+                     std::promise<Result> p) :
+        TimedWaitable(std::move(waitLimit)),
+        quorum_(quorum),
+        futures_(std::forward<TContainer>(futures)),
+        p_(std::move(p))
+    {
+        for (auto iter = futures_.begin(); iter != futures_.end(); ++iter) {
+            pending_.push_back(iter);
+        }
+    }
+
+    FutureWithQuorum(const FutureWithQuorum& o) = delete;
+    FutureWithQuorum& operator=(const FutureWithQuorum& o) = delete;
+
+    // Not movable, since pending_, succeeded_ and failed_ point into futures_
+    FutureWithQuorum(FutureWithQuorum&& o) = delete;
+    FutureWithQuorum& operator=(FutureWithQuorum&& o) = delete;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        if (error_) {
+            return true;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        // The quorum is out of reach once fewer than quorum_ futures have not failed
+        const std::size_t total = succeeded_.size() + failed_.size() + pending_.size();
+
+        auto out = pending_.begin();
+        for (auto iter = pending_.begin(); iter != pending_.end(); ++iter) {
+            if (succeeded_.size() < quorum_ && !error_ &&
+                (*iter)->wait_until(deadline) == std::future_status::ready) {
+                if (auto err = settle(**iter)) {
+                    failed_.emplace_back(*iter, err);
+                    if (total - failed_.size() < quorum_) {
+                        error_ = std::move(err);
+                    }
+                }
+                else {
+                    succeeded_.push_back(*iter);
+                }
+                continue;
+            }
+            *out++ = *iter;
+        }
+        pending_.erase(out, pending_.end());
+
+        return error_ || succeeded_.size() >= quorum_;
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err || error_) {
+            p_.set_exception(err ? err : error_);
+            return;
+        }
+
+        try {
+            Result result;
+
+            std::get<0>(result).reserve(succeeded_.size());
+            for (auto iter : succeeded_) {
+                std::get<0>(result).push_back(std::move(*iter));
+            }
+
+            std::get<1>(result).reserve(pending_.size());
+            for (auto iter : pending_) {
+                std::get<1>(result).push_back(std::move(*iter));
+            }
+
+            std::get<2>(result).reserve(failed_.size());
+            for (auto& failed : failed_) {
+                restore(*failed.first, std::move(failed.second));
+                std::get<2>(result).push_back(std::move(*failed.first));
+            }
+
+            p_.set_value(std::move(result));
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    std::size_t quorum_;
+    Container futures_;
+    std::vector<typename Container::iterator> pending_;
+    std::vector<typename Container::iterator> succeeded_;
+    std::vector<std::pair<typename Container::iterator, std::exception_ptr>> failed_;
+    std::exception_ptr error_;
+    std::promise<Result> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
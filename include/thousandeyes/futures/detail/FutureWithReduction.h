@@ -0,0 +1,125 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <utility>
+#include <vector>
+
+#include <thousandeyes/futures/detail/takeReady.h>
+#include <thousandeyes/futures/TimedWaitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Folds the given futures into an accumulated value, in the order in which
+//! they become ready.
+//!
+//! \par Every poll checks all the pending futures without blocking and folds the
+//! ready ones right away, on the executor's poller, so that they are destroyed as
+//! soon as possible. Only if none of them is ready, it waits for one of the pending
+//! ones until the given timeout expires; that one rotates whenever the wait times out,
+//! so that a future that is slow to become ready does not hide the readiness of the
+//! others.
+//! The #Waitable is ready once all the futures are folded, or once the operation
+//! throws, and its dispatch only sets the result.
+template <class TFuture, class TAcc, class TOp>
+class FutureWithReduction : public TimedWaitable {
+public:
+    FutureWithReduction(std::chrono::microseconds waitLimit,
+                        std::vector<TFuture> futures,
+                        TAcc acc,
+                        TOp op,
+                        std::promise<TAcc> p) :
+        TimedWaitable(std::move(waitLimit)),
+        pending_(std::move(futures)),
+        acc_(std::move(acc)),
+        op_(std::move(op)),
+        p_(std::move(p))
+    {}
+
+    FutureWithReduction(const FutureWithReduction& o) = delete;
+    FutureWithReduction& operator=(const FutureWithReduction& o) = delete;
+
+    FutureWithReduction(FutureWithReduction&& o) = default;
+    FutureWithReduction& operator=(FutureWithReduction&& o) = default;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        if (error_ || pending_.empty()) {
+            return true;
+        }
+
+        if (!foldReady_()) {
+            // Move on to the next pending future only once this one times out
+            auto& f = pending_[nextWait_ % pending_.size()];
+            if (f.wait_for(timeout) != std::future_status::ready) {
+                ++nextWait_;
+                return false;
+            }
+        }
+
+        // Also fold the futures that became ready in the meantime
+        while (!error_ && foldReady_()) {
+        }
+
+        return error_ || pending_.empty();
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        if (err || error_) {
+            p_.set_exception(err ? err : error_);
+            return;
+        }
+
+        try {
+            p_.set_value(std::move(acc_));
+        }
+        catch (...) {
+            p_.set_exception(std::current_exception());
+        }
+    }
+
+private:
+    bool foldReady_()
+    {
+        if (!takeReady(pending_, ready_)) {
+            return false;
+        }
+
+        try {
+            for (auto& f : ready_) {
+                acc_ = op_(std::move(acc_), std::move(f));
+            }
+        }
+        catch (...) {
+            error_ = std::current_exception();
+        }
+
+        ready_.clear();
+        return true;
+    }
+
+    std::vector<TFuture> pending_;
+    std::vector<TFuture> ready_;
+    std::size_t nextWait_{0};
+    TAcc acc_;
+    TOp op_;
+    std::exception_ptr error_;
+    std::promise<TAcc> p_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
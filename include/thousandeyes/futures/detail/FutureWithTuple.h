@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <future>
 #include <tuple>
 #include <utility>
@@ -20,25 +22,35 @@ namespace thousandeyes {
 namespace futures {
 namespace detail {
 
-template <int N, class T>
-struct TupleItemsWaitFor {
-    bool operator()(T& t, const std::chrono::microseconds& timeout)
+//! \brief Waits until the given deadline for the tuple's futures, starting from
+//! the one at index next, which is advanced past every future that is ready.
+template <std::size_t I, std::size_t N>
+struct TupleItemsWaitUntil {
+    template <class T, class TTimePoint>
+    bool operator()(T& t, std::size_t& next, const TTimePoint& deadline) const
     {
-        if (std::get<N>(t).wait_for(timeout) != std::future_status::ready) {
-            return false;
+        if (next == I) {
+            if (std::get<I>(t).wait_until(deadline) != std::future_status::ready) {
+                return false;
+            }
+            ++next;
         }
-        return TupleItemsWaitFor<N - 1, T>()(t, timeout);
+        return TupleItemsWaitUntil<I + 1, N>()(t, next, deadline);
     }
 };
 
-template <class T>
-struct TupleItemsWaitFor<0, T> {
-    bool operator()(T& t, const std::chrono::microseconds& timeout)
+template <std::size_t N>
+struct TupleItemsWaitUntil<N, N> {
+    template <class T, class TTimePoint>
+    bool operator()(T& /* t */, std::size_t& /* next */, const TTimePoint& /* deadline */) const
     {
-        return std::get<0>(t).wait_for(timeout) == std::future_status::ready;
+        return true;
     }
 };
 
+//! \note The futures in the tuple are checked in order and the ones that are
+//! found ready are not checked again, so each poll resumes from the first future
+//! that was not ready, spending at most the given timeout on the whole tuple.
 template <typename... Args>
 class FutureWithTuple : public TimedWaitable {
 public:
@@ -58,8 +70,8 @@ public:
 
     bool timedWait(const std::chrono::microseconds& timeout) override
     {
-        return TupleItemsWaitFor<sizeof...(Args) - 1, std::tuple<std::future<Args>...>>()(futures_,
-                                                                                          timeout);
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        return TupleItemsWaitUntil<0, sizeof...(Args)>()(futures_, next_, deadline);
     }
 
     void dispatch(std::exception_ptr err) override
@@ -79,6 +91,7 @@ public:
 
 private:
     std::tuple<std::future<Args>...> futures_;
+    std::size_t next_{0};
     std::promise<std::tuple<std::future<Args>...>> p_;
 };
 
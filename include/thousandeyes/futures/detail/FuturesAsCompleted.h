@@ -0,0 +1,177 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <thousandeyes/futures/detail/takeReady.h>
+#include <thousandeyes/futures/TimedWaitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Shared state between a #CompletionChannel and the #Waitable that feeds it
+//! with ready futures.
+template <class TFuture>
+class CompletionState {
+public:
+    CompletionState() = default;
+
+    CompletionState(const CompletionState& o) = delete;
+    CompletionState& operator=(const CompletionState& o) = delete;
+
+    //! \brief Appends the given ready futures to the channel, in order, and leaves
+    //! the given vector empty.
+    void push(std::vector<TFuture>& futures)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            for (auto& f : futures) {
+                ready_.push_back(std::move(f));
+            }
+        }
+
+        futures.clear();
+        cv_.notify_all();
+    }
+
+    //! \brief Marks that no more futures are going to be pushed to the channel.
+    //!
+    //! \param err The error that prevented the rest of the futures from being pushed,
+    //! if any.
+    void close(std::exception_ptr err)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            isClosed_ = true;
+            error_ = std::move(err);
+        }
+
+        cv_.notify_all();
+    }
+
+    bool pop(TFuture& f)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        cv_.wait(lock, [this]() { return !ready_.empty() || isClosed_; });
+
+        if (!ready_.empty()) {
+            f = std::move(ready_.front());
+            ready_.pop_front();
+            return true;
+        }
+
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+
+        return false;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<TFuture> ready_;
+    bool isClosed_{false};
+    std::exception_ptr error_;
+};
+
+//! \brief Hands the futures of the container, as soon as each one becomes ready, to
+//! a #CompletionState.
+//!
+//! \par Every poll checks all the pending futures without blocking and pushes the
+//! ready ones in a single batch. Only if none of them is ready, it waits for one of
+//! the pending ones until the given timeout expires; that one rotates whenever the wait
+//! times out, so that a future that is slow to become ready does not hide the readiness
+//! of the others. The #Waitable is ready when all the futures have been pushed.
+template <class TContainer>
+class FuturesAsCompleted : public TimedWaitable {
+public:
+    using Container = typename std::decay<TContainer>::type;
+    using Future = typename Container::value_type;
+
+    FuturesAsCompleted(std::chrono::microseconds waitLimit,
+                       TContainer&& futures,
+                       std::shared_ptr<CompletionState<Future>> state) :
+        TimedWaitable(std::move(waitLimit)),
+        state_(std::move(state))
+    {
+        Container input(std::forward<TContainer>(futures));
+
+        pending_.reserve(input.size());
+        for (auto& f : input) {
+            pending_.push_back(std::move(f));
+        }
+    }
+
+    FuturesAsCompleted(const FuturesAsCompleted& o) = delete;
+    FuturesAsCompleted& operator=(const FuturesAsCompleted& o) = delete;
+
+    FuturesAsCompleted(FuturesAsCompleted&& o) = default;
+    FuturesAsCompleted& operator=(FuturesAsCompleted&& o) = default;
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        if (pending_.empty()) {
+            return true;
+        }
+
+        if (!pushReady_()) {
+            // Move on to the next pending future only once this one times out
+            auto& f = pending_[nextWait_ % pending_.size()];
+            if (f.wait_for(timeout) == std::future_status::ready) {
+                pushReady_();
+            }
+            else {
+                ++nextWait_;
+            }
+        }
+
+        return pending_.empty();
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        state_->close(err);
+    }
+
+private:
+    bool pushReady_()
+    {
+        if (!takeReady(pending_, batch_)) {
+            return false;
+        }
+
+        state_->push(batch_);
+        return true;
+    }
+
+    std::vector<Future> pending_;
+    std::vector<Future> batch_;
+    std::size_t nextWait_{0};
+    std::shared_ptr<CompletionState<Future>> state_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
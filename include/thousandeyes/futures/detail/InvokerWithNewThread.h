@@ -10,18 +10,19 @@
 
 #pragma once
 
-#include <functional>
 #include <mutex>
 #include <thread>
 #include <utility>
 
+#include <thousandeyes/futures/detail/Task.h>
+
 namespace thousandeyes {
 namespace futures {
 namespace detail {
 
 class InvokerWithNewThread {
 public:
-    void operator()(std::function<void()> f)
+    void operator()(Task f)
     {
         std::thread(std::move(f)).detach();
     }
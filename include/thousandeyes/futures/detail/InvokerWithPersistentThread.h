@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+
+#include <thousandeyes/futures/detail/Task.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Invoker that runs the given functions on a single, long-lived thread,
+//! which is parked on a condition variable while there is nothing to run and is
+//! joined when the invoker is destroyed.
+//!
+//! \par It is meant for polling: unlike InvokerWithNewThread, restarting the poller
+//! after it goes idle does not create a new thread.
+//!
+//! \note The functions that are still queued when the invoker is destroyed are
+//! discarded without being invoked. If the invoker is destroyed by its own thread
+//! (e.g., when a function it runs releases the last reference to the executor),
+//! the thread is detached instead, and it exits right after that function returns.
+class InvokerWithPersistentThread {
+public:
+    InvokerWithPersistentThread() :
+        state_(std::make_shared<State>()),
+        thread_([s = state_]() { run(s); })
+    {}
+
+    ~InvokerWithPersistentThread()
+    {
+        if (!state_) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(state_->m);
+            state_->active = false;
+        }
+
+        state_->cv.notify_one();
+
+        if (thread_.get_id() == std::this_thread::get_id()) {
+            thread_.detach();
+        }
+        else {
+            thread_.join();
+        }
+    }
+
+    InvokerWithPersistentThread(InvokerWithPersistentThread&& o) = default;
+    InvokerWithPersistentThread& operator=(InvokerWithPersistentThread&& o) = delete;
+
+    void operator()(Task f)
+    {
+        bool wasEmpty;
+        {
+            std::lock_guard<std::mutex> lock(state_->m);
+
+            wasEmpty = state_->fs.empty();
+            state_->fs.push(std::move(f));
+        }
+
+        if (wasEmpty) {
+            state_->cv.notify_one();
+        }
+    }
+
+private:
+    struct State {
+        std::mutex m;
+        std::condition_variable cv;
+        bool active{true};
+        std::queue<Task> fs;
+    };
+
+    static void run(const std::shared_ptr<State>& s)
+    {
+        std::unique_lock<std::mutex> lock(s->m);
+
+        while (true) {
+            s->cv.wait(lock, [&s]() { return !s->active || !s->fs.empty(); });
+
+            if (!s->active) {
+                return;
+            }
+
+            Task f = std::move(s->fs.front());
+            s->fs.pop();
+
+            lock.unlock();
+            f();
+
+            // Ensure f, which may own the invoker, is destroyed before re-acquiring
+            // the lock
+            f = Task{};
+            lock.lock();
+        }
+    }
+
+    std::shared_ptr<State> state_;
+    std::thread thread_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
@@ -11,69 +11,41 @@
 #pragma once
 
 #include <condition_variable>
-#include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
 #include <utility>
 
+#include <thousandeyes/futures/detail/Task.h>
+
 namespace thousandeyes {
 namespace futures {
 namespace detail {
 
+//! \brief Invokes the given functions, in order, on a single detached thread.
+//!
+//! \note Copies of an invoker share its thread, which stops only when the last
+//! copy is destroyed.
 class InvokerWithSingleThread {
 public:
-    InvokerWithSingleThread() : state_(std::make_shared<State>())
-    {
-        std::thread([s = state_]() {
-            std::unique_lock<std::mutex> lock(s->m);
-
-            while (s->active) {
-                s->cv.wait(lock, [&s]() { return !s->active || !s->fs.empty(); });
-
-                while (!s->fs.empty()) {
-                    std::function<void()> f = std::move(s->fs.front());
-                    s->fs.pop();
-
-                    lock.unlock();
-                    f();
-
-                    // Ensure f is destroyed before re-acquiring the lock
-                    f = std::function<void()>{};
-                    lock.lock();
-                }
-            }
-        }).detach();
-    }
+    InvokerWithSingleThread() : worker_(std::make_shared<Worker>())
+    {}
 
-    ~InvokerWithSingleThread()
+    void operator()(Task f)
     {
-        bool wasActive;
-        {
-            std::lock_guard<std::mutex> lock(state_->m);
-
-            wasActive = state_->active;
-            state_->active = false;
-        }
+        const std::shared_ptr<State>& state = worker_->state;
 
-        if (wasActive) {
-            state_->cv.notify_one();
-        }
-    }
-
-    void operator()(std::function<void()> f)
-    {
         bool wasEmpty;
         {
-            std::lock_guard<std::mutex> lock(state_->m);
+            std::lock_guard<std::mutex> lock(state->m);
 
-            wasEmpty = state_->fs.empty();
-            state_->fs.push(std::move(f));
+            wasEmpty = state->fs.empty();
+            state->fs.push(std::move(f));
         }
 
         if (wasEmpty) {
-            state_->cv.notify_one();
+            state->cv.notify_one();
         }
     }
 
@@ -82,10 +54,50 @@ private:
         std::mutex m;
         std::condition_variable cv;
         bool active{true};
-        std::queue<std::function<void()>> fs;
+        std::queue<Task> fs;
+    };
+
+    struct Worker {
+        Worker() : state(std::make_shared<State>())
+        {
+            std::thread([s = state]() {
+                std::unique_lock<std::mutex> lock(s->m);
+
+                while (s->active) {
+                    s->cv.wait(lock, [&s]() { return !s->active || !s->fs.empty(); });
+
+                    while (!s->fs.empty()) {
+                        Task f = std::move(s->fs.front());
+                        s->fs.pop();
+
+                        lock.unlock();
+                        f();
+
+                        // Ensure f is destroyed before re-acquiring the lock
+                        f = Task{};
+                        lock.lock();
+                    }
+                }
+            }).detach();
+        }
+
+        ~Worker()
+        {
+            {
+                std::lock_guard<std::mutex> lock(state->m);
+                state->active = false;
+            }
+
+            state->cv.notify_one();
+        }
+
+        Worker(const Worker& o) = delete;
+        Worker& operator=(const Worker& o) = delete;
+
+        std::shared_ptr<State> state;
     };
 
-    std::shared_ptr<State> state_;
+    std::shared_ptr<Worker> worker_;
 };
 
 } // namespace detail
@@ -0,0 +1,185 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <thousandeyes/futures/detail/Task.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Invoker that runs the given functions on a fixed pool of threads.
+//!
+//! \par Every thread of the pool owns a deque of functions. Functions invoked from
+//! outside the pool are assigned to the threads in a round-robin fashion, while
+//! functions invoked from within a pool thread are added to that thread's own deque.
+//! Each thread runs the most recently added function of its own deque first and,
+//! when its deque is empty, it steals the oldest function from the deques of the
+//! other threads.
+class InvokerWithThreadPool {
+public:
+    InvokerWithThreadPool() : InvokerWithThreadPool(std::thread::hardware_concurrency())
+    {}
+
+    explicit InvokerWithThreadPool(std::size_t threadCount) :
+        state_(std::make_shared<State>(std::max<std::size_t>(threadCount, 1)))
+    {
+        for (std::size_t i = 0; i < state_->workers.size(); ++i) {
+            std::thread([s = state_, i]() { run(s, i); }).detach();
+        }
+    }
+
+    ~InvokerWithThreadPool()
+    {
+        if (!state_) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(state_->m);
+            state_->active = false;
+        }
+
+        state_->cv.notify_all();
+    }
+
+    InvokerWithThreadPool(InvokerWithThreadPool&& o) = default;
+    InvokerWithThreadPool& operator=(InvokerWithThreadPool&& o) = delete;
+
+    void operator()(Task f)
+    {
+        const auto& current = currentWorker();
+
+        std::size_t i;
+        if (current.first == state_.get()) {
+            i = current.second;
+        }
+        else {
+            i = state_->next.fetch_add(1, std::memory_order_relaxed) % state_->workers.size();
+        }
+
+        state_->pending.fetch_add(1);
+
+        {
+            Worker& w = *state_->workers[i];
+            std::lock_guard<std::mutex> lock(w.m);
+            w.fs.push_back(std::move(f));
+        }
+
+        if (state_->idle.load() > 0) {
+            std::lock_guard<std::mutex> lock(state_->m);
+            state_->cv.notify_one();
+        }
+    }
+
+private:
+    struct Worker {
+        std::mutex m;
+        std::deque<Task> fs;
+    };
+
+    struct State {
+        explicit State(std::size_t threadCount)
+        {
+            workers.reserve(threadCount);
+            for (std::size_t i = 0; i < threadCount; ++i) {
+                workers.push_back(std::make_unique<Worker>());
+            }
+        }
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::atomic<std::size_t> next{0};
+        std::atomic<std::size_t> pending{0};
+        std::atomic<std::size_t> idle{0};
+
+        std::mutex m;
+        std::condition_variable cv;
+        bool active{true};
+    };
+
+    static std::pair<const State*, std::size_t>& currentWorker()
+    {
+        static thread_local std::pair<const State*, std::size_t> current{nullptr, 0};
+        return current;
+    }
+
+    static bool tryPop(State& s, std::size_t i, Task& f)
+    {
+        {
+            Worker& w = *s.workers[i];
+            std::lock_guard<std::mutex> lock(w.m);
+
+            if (!w.fs.empty()) {
+                f = std::move(w.fs.back());
+                w.fs.pop_back();
+                s.pending.fetch_sub(1);
+                return true;
+            }
+        }
+
+        for (std::size_t k = 1; k < s.workers.size(); ++k) {
+            Worker& w = *s.workers[(i + k) % s.workers.size()];
+            std::lock_guard<std::mutex> lock(w.m);
+
+            if (!w.fs.empty()) {
+                f = std::move(w.fs.front());
+                w.fs.pop_front();
+                s.pending.fetch_sub(1);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static void run(std::shared_ptr<State> s, std::size_t i)
+    {
+        currentWorker() = std::make_pair(s.get(), i);
+
+        while (true) {
+            Task f;
+            if (tryPop(*s, i, f)) {
+                f();
+
+                // Ensure f is destroyed before looking for more work
+                f = Task{};
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(s->m);
+
+            if (!s->active && s->pending.load() == 0) {
+                break;
+            }
+
+            s->idle.fetch_add(1);
+            s->cv.wait(lock, [&s]() { return !s->active || s->pending.load() > 0; });
+            s->idle.fetch_sub(1);
+        }
+
+        currentWorker() = std::make_pair(nullptr, 0);
+    }
+
+    std::shared_ptr<State> state_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Lock-free, unbounded, multi-producer queue that is drained in bulk.
+//!
+//! \par Producers push their items onto an intrusive stack with a single CAS and
+//! the consumer detaches the whole stack with a single exchange, restoring the
+//! FIFO order afterwards. Since draining takes all the items at once, any number
+//! of threads can safely drain the queue concurrently.
+template <class T>
+class MpscQueue {
+public:
+    MpscQueue() = default;
+
+    ~MpscQueue()
+    {
+        drain([](T) {});
+    }
+
+    MpscQueue(const MpscQueue& o) = delete;
+    MpscQueue& operator=(const MpscQueue& o) = delete;
+
+    //! \brief Adds the given item to the queue.
+    void push(T item)
+    {
+        Node* node = new Node{std::move(item), head_.load(std::memory_order_relaxed)};
+
+        while (!head_.compare_exchange_weak(
+            node->next, node, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        }
+    }
+
+    //! \brief Removes all the items from the queue, in the order they were pushed.
+    //!
+    //! \param f The function that takes ownership of every removed item.
+    //!
+    //! \return the number of removed items.
+    template <class TFunc>
+    std::size_t drain(TFunc&& f)
+    {
+        Node* node = head_.exchange(nullptr, std::memory_order_seq_cst);
+
+        Node* reversed = nullptr;
+        while (node) {
+            Node* next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        std::size_t count = 0;
+        while (reversed) {
+            Node* next = reversed->next;
+            f(std::move(reversed->item));
+            delete reversed;
+            reversed = next;
+            ++count;
+        }
+
+        return count;
+    }
+
+    bool empty() const
+    {
+        return head_.load(std::memory_order_seq_cst) == nullptr;
+    }
+
+private:
+    struct Node {
+        T item;
+        Node* next;
+    };
+
+    std::atomic<Node*> head_{nullptr};
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
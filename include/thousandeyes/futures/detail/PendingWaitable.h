@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <utility>
+
+#include <thousandeyes/futures/PollingOptions.h>
+#include <thousandeyes/futures/Waitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief A #Waitable that is pending on a polling #Executor, along with the time
+//! it was first seen by the poller and the time it is due to be polled next.
+struct PendingWaitable {
+    using Clock = std::chrono::steady_clock;
+
+    PendingWaitable(std::unique_ptr<Waitable> w, Clock::time_point now) :
+        w(std::move(w)),
+        since(now),
+        nextPoll(now)
+    {}
+
+    bool isDue(Clock::time_point now) const
+    {
+        return nextPoll <= now;
+    }
+
+    //! \brief Schedules the next poll, after the #Waitable was polled at the given
+    //! time and was not ready, so that it is polled again once its age doubles.
+    //!
+    //! \par The next poll is never scheduled past the #Waitable's deadline, so that
+    //! backing off does not delay its timing out.
+    void backOff(const PollingBackoff& backoff, Clock::time_point now)
+    {
+        const auto age = now - since;
+        if (backoff.initial.count() <= 0 || age < backoff.initial) {
+            return;
+        }
+
+        nextPoll = now + std::min<Clock::duration>(age, backoff.max);
+
+        if (w->deadline().count() > 0) {
+            const Clock::time_point deadline(
+                std::chrono::duration_cast<Clock::duration>(w->deadline()));
+            nextPoll = std::min(nextPoll, std::max(deadline, now));
+        }
+    }
+
+    std::unique_ptr<Waitable> w;
+    Clock::time_point since;
+    Clock::time_point nextPoll;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
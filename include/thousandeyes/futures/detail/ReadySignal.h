@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include <thousandeyes/futures/Executor.h>
+#include <thousandeyes/futures/Waitable.h>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Shared state between a #Promise and its #Future that hands the #Waitable
+//! depending on the #Future to its #Executor once the #Promise is satisfied.
+class ReadySignal {
+public:
+    ReadySignal() = default;
+
+    ReadySignal(const ReadySignal& o) = delete;
+    ReadySignal& operator=(const ReadySignal& o) = delete;
+
+    //! \brief Registers the #Waitable that depends on the signal's #Future.
+    //!
+    //! \par If the signal has already been notified, the #Waitable is handed to
+    //! the executor right away.
+    //!
+    //! \note Only a single #Waitable can be registered, since a #Future can only
+    //! be consumed once.
+    //!
+    //! \note The signal does not keep the executor alive: if the executor is gone
+    //! by the time the signal is notified, the #Waitable is dispatched right away
+    //! with a #WaitableWaitException. A stopped executor that is still alive cancels
+    //! it in the same way from its Executor::ready() method.
+    void subscribe(std::shared_ptr<Executor> executor, std::unique_ptr<Waitable> w)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (!isNotified_) {
+                executor_ = executor;
+                waitable_ = std::move(w);
+                return;
+            }
+        }
+
+        executor->ready(std::move(w));
+    }
+
+    //! \brief Marks the signal's #Future as ready and hands the registered
+    //! #Waitable, if any, to its executor.
+    //!
+    //! \note Only the first notification has an effect.
+    void notify()
+    {
+        std::weak_ptr<Executor> executor;
+        std::unique_ptr<Waitable> w;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (isNotified_) {
+                return;
+            }
+
+            isNotified_ = true;
+            executor.swap(executor_);
+            w.swap(waitable_);
+        }
+
+        if (!w) {
+            return;
+        }
+
+        if (auto e = executor.lock()) {
+            e->ready(std::move(w));
+            return;
+        }
+
+        w->dispatch(std::make_exception_ptr(WaitableWaitException("Executor destroyed")));
+    }
+
+private:
+    std::mutex mutex_;
+    bool isNotified_{false};
+    std::weak_ptr<Executor> executor_;
+    std::unique_ptr<Waitable> waitable_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
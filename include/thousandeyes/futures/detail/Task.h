@@ -0,0 +1,194 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Move-only, type-erased void() callable with a small buffer.
+//!
+//! \par Unlike std::function, a Task does not require the callable to be
+//! copyable and stores callables of up to kBufferSize bytes (e.g., a lambda that
+//! captures a std::unique_ptr and an std::exception_ptr) without allocating.
+//! Larger callables are stored on the heap.
+class Task {
+public:
+    static constexpr std::size_t kBufferSize = 4 * sizeof(void*);
+
+    Task() noexcept = default;
+
+    template <class TFunc,
+              class = typename std::enable_if<
+                  !std::is_same<typename std::decay<TFunc>::type, Task>::value>::type>
+    Task(TFunc&& f)
+    {
+        using F = typename std::decay<TFunc>::type;
+        construct_<F>(std::forward<TFunc>(f), std::integral_constant<bool, isSmall_<F>()>{});
+    }
+
+    ~Task()
+    {
+        reset_();
+    }
+
+    Task(const Task& o) = delete;
+    Task& operator=(const Task& o) = delete;
+
+    Task(Task&& o) noexcept
+    {
+        moveFrom_(o);
+    }
+
+    Task& operator=(Task&& o) noexcept
+    {
+        if (this != &o) {
+            reset_();
+            moveFrom_(o);
+        }
+        return *this;
+    }
+
+    void operator()()
+    {
+        ops_->invoke(&buffer_);
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return ops_ != nullptr;
+    }
+
+private:
+    struct Ops {
+        void (*invoke)(void* buffer);
+        void (*move)(void* to, void* from);
+        void (*destroy)(void* buffer);
+    };
+
+    using Buffer = typename std::aligned_storage<kBufferSize, alignof(std::max_align_t)>::type;
+
+    template <class F>
+    static constexpr bool isSmall_()
+    {
+        return sizeof(F) <= kBufferSize && alignof(std::max_align_t) % alignof(F) == 0 &&
+               std::is_nothrow_move_constructible<F>::value;
+    }
+
+    template <class F>
+    struct SmallOps {
+        static void invoke(void* buffer)
+        {
+            (*static_cast<F*>(buffer))();
+        }
+
+        static void move(void* to, void* from) noexcept
+        {
+            ::new (to) F(std::move(*static_cast<F*>(from)));
+            static_cast<F*>(from)->~F();
+        }
+
+        static void destroy(void* buffer) noexcept
+        {
+            static_cast<F*>(buffer)->~F();
+        }
+
+        static constexpr Ops ops{&invoke, &move, &destroy};
+    };
+
+    template <class F>
+    struct LargeOps {
+        static void invoke(void* buffer)
+        {
+            (**static_cast<F**>(buffer))();
+        }
+
+        static void move(void* to, void* from) noexcept
+        {
+            *static_cast<F**>(to) = *static_cast<F**>(from);
+        }
+
+        static void destroy(void* buffer) noexcept
+        {
+            delete *static_cast<F**>(buffer);
+        }
+
+        static constexpr Ops ops{&invoke, &move, &destroy};
+    };
+
+    template <class F, class TFunc>
+    void construct_(TFunc&& f, std::true_type /* isSmall */)
+    {
+        ::new (static_cast<void*>(&buffer_)) F(std::forward<TFunc>(f));
+        ops_ = &SmallOps<F>::ops;
+    }
+
+    template <class F, class TFunc>
+    void construct_(TFunc&& f, std::false_type /* isSmall */)
+    {
+        ::new (static_cast<void*>(&buffer_)) F*(new F(std::forward<TFunc>(f)));
+        ops_ = &LargeOps<F>::ops;
+    }
+
+    void moveFrom_(Task& o) noexcept
+    {
+        if (o.ops_) {
+            o.ops_->move(&buffer_, &o.buffer_);
+            ops_ = o.ops_;
+            o.ops_ = nullptr;
+        }
+    }
+
+    void reset_() noexcept
+    {
+        if (ops_) {
+            ops_->destroy(&buffer_);
+            ops_ = nullptr;
+        }
+    }
+
+    Buffer buffer_;
+    const Ops* ops_{nullptr};
+};
+
+template <class F>
+constexpr Task::Ops Task::SmallOps<F>::ops;
+
+template <class F>
+constexpr Task::Ops Task::LargeOps<F>::ops;
+
+template <class TMemberFunc>
+struct first_param_is_task : std::false_type {};
+
+template <class C, class R, class TArg>
+struct first_param_is_task<R (C::*)(TArg)> :
+    std::is_same<typename std::decay<TArg>::type, Task> {};
+
+template <class C, class R, class TArg>
+struct first_param_is_task<R (C::*)(TArg) const> :
+    std::is_same<typename std::decay<TArg>::type, Task> {};
+
+//! \brief Type trait that determines whether the given invoker's (non-overloaded)
+//! function-call operator takes a #Task, in which case functions can be passed to
+//! it without type-erasing them into a std::function.
+template <class TInvoker, class = void>
+struct accepts_task : std::false_type {};
+
+template <class TInvoker>
+struct accepts_task<TInvoker, decltype(void(&TInvoker::operator()))> :
+    first_param_is_task<decltype(&TInvoker::operator())> {};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
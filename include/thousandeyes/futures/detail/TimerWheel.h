@@ -0,0 +1,245 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Hierarchical timing wheel that keeps items ordered by their deadline.
+//!
+//! \par Items are placed on the lowest level whose slots can tell their deadline
+//! apart from the current time and are cascaded to the lower levels as the time
+//! advances, so that expiring an item costs O(1), irrespective of the number of
+//! items in the wheel. Items without a deadline (i.e., with a deadline <= 0) never
+//! expire.
+//!
+//! \note Deadlines and timestamps are in number of ms since the Epoch, as returned
+//! by Waitable::deadline() and toEpochTimestamp().
+template <class T>
+class TimerWheel {
+public:
+    explicit TimerWheel(std::chrono::milliseconds epochTimestamp) : now_(epochTimestamp.count())
+    {}
+
+    TimerWheel(const TimerWheel& o) = delete;
+    TimerWheel& operator=(const TimerWheel& o) = delete;
+
+    //! \brief Adds the given item to the wheel.
+    //!
+    //! \param epochDeadline The item's deadline or zero if the item never expires.
+    //! \param item The item to add.
+    void insert(std::chrono::milliseconds epochDeadline, T item)
+    {
+        ++size_;
+
+        if (epochDeadline.count() <= 0) {
+            untimed_.push_back(std::move(item));
+            return;
+        }
+
+        place_(Entry{epochDeadline.count(), std::move(item)});
+    }
+
+    //! \brief Advances the wheel to the given timestamp, removing all the items
+    //! whose deadline is less than or equal to it.
+    //!
+    //! \param epochTimestamp The current timestamp.
+    //! \param onExpired The function that takes ownership of every expired item.
+    template <class TFunc>
+    void advance(std::chrono::milliseconds epochTimestamp, TFunc&& onExpired)
+    {
+        const std::int64_t now = epochTimestamp.count();
+
+        if (now > now_) {
+            if (size_ == untimed_.size() + due_.size()) {
+                now_ = now;
+            }
+            else if (now - now_ >= kSpan) {
+                rebuild_(now);
+            }
+            else {
+                while (now_ < now) {
+                    tick_();
+                }
+            }
+        }
+
+        std::vector<Entry> due;
+        due.swap(due_);
+
+        size_ -= due.size();
+        for (Entry& e : due) {
+            onExpired(std::move(e.item));
+        }
+    }
+
+    //! \brief Visits the items, roughly in deadline order, and removes the ones
+    //! for which the given predicate returns true.
+    //!
+    //! \param pred The predicate that is invoked with a reference to every item
+    //! and may take ownership of it, if it returns true.
+    template <class TPred>
+    void removeIf(TPred&& pred)
+    {
+        auto entryPred = [&pred](Entry& e) { return pred(e.item); };
+
+        std::size_t removed = 0;
+
+        for (std::size_t level = 0; level < kLevels; ++level) {
+            const std::size_t current = digit_(now_, level);
+            for (std::size_t i = 1; i <= kSlots; ++i) {
+                removed += removeIf_(slots_[level][(current + i) & kMask], entryPred);
+            }
+        }
+
+        removed += removeIf_(overflow_, entryPred);
+        removed += removeIf_(due_, entryPred);
+        removed += removeIf_(untimed_, pred);
+
+        size_ -= removed;
+    }
+
+    //! \brief Removes all the items from the wheel.
+    //!
+    //! \param f The function that takes ownership of every item.
+    template <class TFunc>
+    void clear(TFunc&& f)
+    {
+        removeIf([&f](T& item) {
+            f(std::move(item));
+            return true;
+        });
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+private:
+    struct Entry {
+        std::int64_t deadline;
+        T item;
+    };
+
+    static constexpr std::size_t kBits = 6;
+    static constexpr std::size_t kSlots = std::size_t{1} << kBits;
+    static constexpr std::size_t kMask = kSlots - 1;
+    static constexpr std::size_t kLevels = 4;
+    static constexpr std::int64_t kSpan = std::int64_t{1} << (kBits * kLevels);
+
+    static std::size_t digit_(std::int64_t t, std::size_t level)
+    {
+        return static_cast<std::size_t>(t >> (kBits * level)) & kMask;
+    }
+
+    void place_(Entry e)
+    {
+        if (e.deadline <= now_) {
+            due_.push_back(std::move(e));
+            return;
+        }
+
+        for (std::size_t level = 0; level < kLevels; ++level) {
+            const std::size_t shift = kBits * (level + 1);
+            if ((e.deadline >> shift) == (now_ >> shift)) {
+                slots_[level][digit_(e.deadline, level)].push_back(std::move(e));
+                return;
+            }
+        }
+
+        overflow_.push_back(std::move(e));
+    }
+
+    void cascade_(std::vector<Entry>& slot)
+    {
+        std::vector<Entry> entries;
+        entries.swap(slot);
+
+        for (Entry& e : entries) {
+            place_(std::move(e));
+        }
+    }
+
+    void tick_()
+    {
+        ++now_;
+
+        if ((now_ & (kSpan - 1)) == 0) {
+            cascade_(overflow_);
+        }
+
+        for (std::size_t level = kLevels - 1; level > 0; --level) {
+            if ((now_ & ((std::int64_t{1} << (kBits * level)) - 1)) == 0) {
+                cascade_(slots_[level][digit_(now_, level)]);
+            }
+        }
+
+        std::vector<Entry>& slot = slots_[0][digit_(now_, 0)];
+        std::move(slot.begin(), slot.end(), std::back_inserter(due_));
+        slot.clear();
+    }
+
+    void rebuild_(std::int64_t now)
+    {
+        std::vector<Entry> entries;
+        entries.swap(overflow_);
+
+        for (auto& level : slots_) {
+            for (auto& slot : level) {
+                std::move(slot.begin(), slot.end(), std::back_inserter(entries));
+                slot.clear();
+            }
+        }
+
+        now_ = now;
+
+        for (Entry& e : entries) {
+            place_(std::move(e));
+        }
+    }
+
+    template <class TItem, class TPred>
+    static std::size_t removeIf_(std::vector<TItem>& items, TPred& pred)
+    {
+        auto iter = std::remove_if(
+            items.begin(), items.end(), [&pred](TItem& item) { return pred(item); });
+
+        const auto removed = static_cast<std::size_t>(std::distance(iter, items.end()));
+        items.erase(iter, items.end());
+        return removed;
+    }
+
+    std::int64_t now_;
+    std::size_t size_{0};
+
+    std::array<std::array<std::vector<Entry>, kSlots>, kLevels> slots_;
+    std::vector<Entry> overflow_;
+    std::vector<Entry> due_;
+    std::vector<T> untimed_;
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <typeinfo>
+#include <vector>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief A fixed-size record of the trace-event format.
+//!
+//! \par The name is a static string or, if it is null, the name of the type. The
+//! timestamps are in ns since the epoch of the steady clock.
+struct TraceEvent {
+    char phase;
+    std::uint32_t tid;
+    const char* name;
+    const std::type_info* type;
+    std::uintptr_t id;
+    std::int64_t ts;
+    std::int64_t dur;
+    std::int64_t arg;
+};
+
+//! \brief A ring buffer of trace events with a single producer, which overwrites
+//! its oldest events once it is full.
+//!
+//! \note The events are read without synchronizing with the producer, so they must
+//! only be read while the producer is not recording.
+class TraceBuffer {
+public:
+    static constexpr std::size_t kCapacity = std::size_t(1) << 13;
+
+    TraceBuffer() : events_(new TraceEvent[kCapacity])
+    {}
+
+    TraceBuffer(const TraceBuffer& o) = delete;
+    TraceBuffer& operator=(const TraceBuffer& o) = delete;
+
+    void record(const TraceEvent& e)
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        events_[head & (kCapacity - 1)] = e;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    //! \brief Invokes the given functor on the retained events, oldest first.
+    template <class TFunc>
+    void forEach(TFunc&& f) const
+    {
+        const auto head = head_.load(std::memory_order_acquire);
+        const auto tail = tail_.load(std::memory_order_relaxed);
+
+        auto first = head > kCapacity ? head - kCapacity : 0;
+        if (first < tail) {
+            first = tail;
+        }
+
+        for (auto i = first; i < head; ++i) {
+            f(events_[i & (kCapacity - 1)]);
+        }
+    }
+
+    //! \brief Discards the recorded events, without touching the producer's state.
+    void clear()
+    {
+        tail_.store(head_.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+
+private:
+    std::unique_ptr<TraceEvent[]> events_;
+    std::atomic<std::uint64_t> head_{0};
+    std::atomic<std::uint64_t> tail_{0};
+};
+
+//! \brief Process-wide log of trace events, which are recorded in per-thread
+//! #TraceBuffer instances.
+//!
+//! \par Every thread takes a buffer the first time it records an event and returns
+//! it, along with its events, when it exits, so that the next new thread reuses it.
+//! Hence, recording an event only takes a lock once per thread, and the threads that
+//! are created per task (e.g., by InvokerWithNewThread) do not grow the log.
+class TraceLog {
+public:
+    static void record(TraceEvent e)
+    {
+        if (Local* local = local_()) {
+            e.tid = local->tid;
+            local->buffer->record(e);
+        }
+    }
+
+    //! \brief Invokes the given functor on the events of all the threads.
+    template <class TFunc>
+    static void forEach(TFunc&& f)
+    {
+        Global& g = global_();
+        std::lock_guard<std::mutex> lock(g.m);
+
+        for (const auto& buffer : g.buffers) {
+            buffer->forEach(f);
+        }
+    }
+
+    static void clear()
+    {
+        Global& g = global_();
+        std::lock_guard<std::mutex> lock(g.m);
+
+        for (const auto& buffer : g.buffers) {
+            buffer->clear();
+        }
+    }
+
+private:
+    struct Global {
+        std::mutex m;
+        std::vector<std::unique_ptr<TraceBuffer>> buffers;
+        std::vector<TraceBuffer*> free;
+        std::uint32_t lastTid{0};
+    };
+
+    struct Local {
+        Local()
+        {
+            Global& g = global_();
+            std::lock_guard<std::mutex> lock(g.m);
+
+            if (g.free.empty()) {
+                g.buffers.push_back(std::make_unique<TraceBuffer>());
+                buffer = g.buffers.back().get();
+            }
+            else {
+                buffer = g.free.back();
+                g.free.pop_back();
+            }
+
+            tid = ++g.lastTid;
+        }
+
+        Local(const Local& o) = delete;
+        Local& operator=(const Local& o) = delete;
+
+        ~Local()
+        {
+            isDestroyed_() = true;
+
+            Global& g = global_();
+            std::lock_guard<std::mutex> lock(g.m);
+            g.free.push_back(buffer);
+        }
+
+        TraceBuffer* buffer;
+        std::uint32_t tid;
+    };
+
+    static Global& global_()
+    {
+        // Intentionally leaked, so that it outlives every thread-local buffer
+        static Global* global = new Global();
+        return *global;
+    }
+
+    static bool& isDestroyed_()
+    {
+        // Trivially destructible, so that it can be checked during thread exit
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    static Local* local_()
+    {
+        if (isDestroyed_()) {
+            return nullptr;
+        }
+
+        static thread_local Local local;
+        return &local;
+    }
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
@@ -0,0 +1,296 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Process-wide size-class pool that backs the allocation of #Waitable objects.
+//!
+//! \par Every block starts with a #Header that records how the block has to be
+//! released, so that objects allocated by different means (e.g., by an allocator)
+//! can be deleted uniformly through a pointer to their base class.
+//!
+//! \par Each thread caches the blocks it frees, per size class, and hands them back
+//! in batches to a global list that is protected by a mutex, from which the threads
+//! that run out of blocks take whole batches. Hence, blocks that are allocated on one
+//! thread (e.g., by then()) and freed on another (e.g., the dispatching thread) are
+//! recycled without touching the global list on every operation.
+class WaitablePool {
+public:
+    //! \brief The prefix of every block, which is maximally aligned so that the
+    //! object that follows it is maximally aligned too.
+    struct alignas(alignof(std::max_align_t)) Header {
+        void (*release)(Header* header);
+        std::size_t size;
+    };
+
+    //! \brief Allocates a block for an object of the given size.
+    //!
+    //! \return a pointer to the memory for the object, right after the block's header.
+    static void* allocate(std::size_t size)
+    {
+        const std::size_t total = size + sizeof(Header);
+
+        Header* header;
+        if (total > kMaxBlockSize) {
+            header = static_cast<Header*>(::operator new(total));
+            header->release = &releaseLarge_;
+        }
+        else {
+            header = static_cast<Header*>(pop_(classOf_(total)));
+            header->release = &releasePooled_;
+        }
+
+        header->size = total;
+        return header + 1;
+    }
+
+    //! \brief Allocates a block for an object of the given size, using the given
+    //! allocator instead of the pool.
+    //!
+    //! \par A copy of the allocator is stored in front of the block's header and
+    //! is used to release the block when the object is deleted.
+    //!
+    //! \return a pointer to the memory for the object, right after the block's header.
+    template <class TAlloc>
+    static void* allocate(std::size_t size, const TAlloc& alloc)
+    {
+        using UnitAlloc = typename std::allocator_traits<TAlloc>::template rebind_alloc<Header>;
+
+        static_assert(alignof(UnitAlloc) <= alignof(Header),
+                      "The allocator must not be over-aligned");
+
+        const std::size_t units =
+            allocatorUnits_<UnitAlloc>() + 1 + (size + sizeof(Header) - 1) / sizeof(Header);
+
+        UnitAlloc unitAlloc(alloc);
+        Header* block = std::allocator_traits<UnitAlloc>::allocate(unitAlloc, units);
+        ::new (static_cast<void*>(block)) UnitAlloc(std::move(unitAlloc));
+
+        Header* header = block + allocatorUnits_<UnitAlloc>();
+        header->release = &releaseWithAllocator_<UnitAlloc>;
+        header->size = units;
+        return header + 1;
+    }
+
+    //! \brief Releases the block of the object at the given address, which must
+    //! have been returned by allocate() or must be preceded by a valid #Header.
+    static void deallocate(void* p) noexcept
+    {
+        if (p) {
+            Header* header = static_cast<Header*>(p) - 1;
+            header->release(header);
+        }
+    }
+
+private:
+    static constexpr std::size_t kGranularity = 64;
+    static constexpr std::size_t kClasses = 8;
+    static constexpr std::size_t kMaxBlockSize = kGranularity * kClasses;
+    static constexpr std::size_t kBatchSize = 32;
+    static constexpr std::size_t kMaxGlobalBatches = 256;
+
+    struct Block {
+        Block* next;
+    };
+
+    struct Batch {
+        Block* head;
+        std::size_t count;
+    };
+
+    struct Global {
+        std::mutex m;
+        std::array<std::vector<Batch>, kClasses> batches;
+    };
+
+    struct ThreadCache {
+        ThreadCache() = default;
+
+        ThreadCache(const ThreadCache& o) = delete;
+        ThreadCache& operator=(const ThreadCache& o) = delete;
+
+        ~ThreadCache()
+        {
+            isDestroyed_() = true;
+
+            for (std::size_t i = 0; i < kClasses; ++i) {
+                while (lists[i].head) {
+                    pushBatch_(i, takeBatch_(lists[i]));
+                }
+            }
+        }
+
+        std::array<Batch, kClasses> lists{};
+    };
+
+    static std::size_t classOf_(std::size_t total)
+    {
+        return (total - 1) / kGranularity;
+    }
+
+    static std::size_t blockSizeOf_(std::size_t i)
+    {
+        return (i + 1) * kGranularity;
+    }
+
+    static Global& global_()
+    {
+        // Intentionally leaked, so that it outlives every thread-local cache
+        static Global* global = new Global();
+        return *global;
+    }
+
+    static bool& isDestroyed_()
+    {
+        // Trivially destructible, so that it can be checked during thread exit
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    static ThreadCache* cache_()
+    {
+        if (isDestroyed_()) {
+            return nullptr;
+        }
+
+        static thread_local ThreadCache cache;
+        return &cache;
+    }
+
+    static Batch takeBatch_(Batch& list)
+    {
+        Batch batch{list.head, 0};
+
+        Block* last = nullptr;
+        while (list.head && batch.count < kBatchSize) {
+            last = list.head;
+            list.head = list.head->next;
+            ++batch.count;
+        }
+
+        last->next = nullptr;
+        list.count -= batch.count;
+        return batch;
+    }
+
+    static void pushBatch_(std::size_t i, Batch batch)
+    {
+        {
+            Global& g = global_();
+            std::lock_guard<std::mutex> lock(g.m);
+
+            if (g.batches[i].size() < kMaxGlobalBatches) {
+                g.batches[i].push_back(batch);
+                return;
+            }
+        }
+
+        while (batch.head) {
+            Block* next = batch.head->next;
+            ::operator delete(batch.head);
+            batch.head = next;
+        }
+    }
+
+    static Batch popBatch_(std::size_t i)
+    {
+        Global& g = global_();
+        std::lock_guard<std::mutex> lock(g.m);
+
+        if (g.batches[i].empty()) {
+            return Batch{nullptr, 0};
+        }
+
+        Batch batch = g.batches[i].back();
+        g.batches[i].pop_back();
+        return batch;
+    }
+
+    static void* pop_(std::size_t i)
+    {
+        ThreadCache* cache = cache_();
+        if (!cache) {
+            return ::operator new(blockSizeOf_(i));
+        }
+
+        Batch& list = cache->lists[i];
+        if (!list.head) {
+            list = popBatch_(i);
+            if (!list.head) {
+                return ::operator new(blockSizeOf_(i));
+            }
+        }
+
+        Block* block = list.head;
+        list.head = block->next;
+        --list.count;
+        return block;
+    }
+
+    static void releasePooled_(Header* header)
+    {
+        const std::size_t i = classOf_(header->size);
+
+        ThreadCache* cache = cache_();
+        if (!cache) {
+            ::operator delete(header);
+            return;
+        }
+
+        Batch& list = cache->lists[i];
+
+        Block* block = reinterpret_cast<Block*>(header);
+        block->next = list.head;
+        list.head = block;
+        ++list.count;
+
+        if (list.count >= 2 * kBatchSize) {
+            pushBatch_(i, takeBatch_(list));
+        }
+    }
+
+    static void releaseLarge_(Header* header)
+    {
+        ::operator delete(header);
+    }
+
+    template <class TUnitAlloc>
+    static constexpr std::size_t allocatorUnits_()
+    {
+        return (sizeof(TUnitAlloc) + sizeof(Header) - 1) / sizeof(Header);
+    }
+
+    template <class TUnitAlloc>
+    static void releaseWithAllocator_(Header* header)
+    {
+        Header* block = header - allocatorUnits_<TUnitAlloc>();
+        const std::size_t units = header->size;
+
+        TUnitAlloc* stored = reinterpret_cast<TUnitAlloc*>(block);
+        TUnitAlloc unitAlloc(std::move(*stored));
+        stored->~TUnitAlloc();
+
+        std::allocator_traits<TUnitAlloc>::deallocate(unitAlloc, block, units);
+    }
+};
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
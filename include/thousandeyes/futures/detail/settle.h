@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <utility>
+#include <vector>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Extracts the outcome of the given ready future.
+//!
+//! \par Since the only way to tell whether an std::future holds an exception is to
+//! get() it, a future that holds a value is replaced by an equivalent ready future,
+//! so that it remains valid. A future that holds an exception is left consumed;
+//! the callers that need it back call restore() with the returned exception.
+//!
+//! \return The exception that the given future holds or nullptr if it holds a value.
+template <class T>
+std::exception_ptr settle(std::future<T>& f)
+{
+    std::promise<T> p;
+
+    try {
+        p.set_value(f.get());
+    }
+    catch (...) {
+        return std::current_exception();
+    }
+
+    f = p.get_future();
+    return nullptr;
+}
+
+//! \brief Extracts the outcome of the given ready void future, which is replaced by
+//! an equivalent ready future if it holds a value.
+//!
+//! \return The exception that the given future holds or nullptr.
+inline std::exception_ptr settle(std::future<void>& f)
+{
+    try {
+        f.get();
+    }
+    catch (...) {
+        return std::current_exception();
+    }
+
+    std::promise<void> p;
+    p.set_value();
+
+    f = p.get_future();
+    return nullptr;
+}
+
+//! \brief Extracts the outcome of the given ready shared future, which remains valid.
+//!
+//! \return The exception that the given future holds or nullptr.
+template <class T>
+std::exception_ptr settle(const std::shared_future<T>& f)
+{
+    try {
+        f.get();
+    }
+    catch (...) {
+        return std::current_exception();
+    }
+    return nullptr;
+}
+
+//! \brief Makes the given future, which settle() found to hold the given exception,
+//! valid again.
+template <class T>
+void restore(std::future<T>& f, std::exception_ptr err)
+{
+    std::promise<T> p;
+    p.set_exception(std::move(err));
+
+    f = p.get_future();
+}
+
+//! \brief Does nothing, since settle() does not consume a shared future.
+template <class T>
+void restore(std::shared_future<T>& /* f */, std::exception_ptr /* err */)
+{}
+
+//! \brief Settles the pending futures, which are given as iterators, that become
+//! ready until the given deadline and removes them from the pending ones.
+//!
+//! \par Only the first future that is not ready may be waited for until the deadline;
+//! the ones after it are merely checked, so that an exception held by any of the
+//! pending futures is found within a single call.
+//!
+//! \par On an exception, the futures after the failed one are left pending without
+//! being checked.
+//!
+//! \return The first exception found, or nullptr if no settled future holds one.
+template <class TIterator, class TTimePoint>
+std::exception_ptr settleUntil(std::vector<TIterator>& pending, const TTimePoint& deadline)
+{
+    auto out = pending.begin();
+    for (auto iter = pending.begin(); iter != pending.end(); ++iter) {
+        if ((*iter)->wait_until(deadline) != std::future_status::ready) {
+            *out++ = *iter;
+            continue;
+        }
+
+        if (auto err = settle(**iter)) {
+            // Drop the settled futures, including the failed one, before bailing out
+            out = std::move(iter + 1, pending.end(), out);
+            pending.erase(out, pending.end());
+            return err;
+        }
+    }
+
+    pending.erase(out, pending.end());
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <utility>
+#include <vector>
+
+namespace thousandeyes {
+namespace futures {
+namespace detail {
+
+//! \brief Moves the pending futures that are ready, without blocking, to the end of
+//! the given ready futures.
+//!
+//! \note The pending futures do not retain their order, since every ready one is
+//! replaced by the last pending one.
+//!
+//! \return True if any of the pending futures was ready.
+template <class TFuture>
+bool takeReady(std::vector<TFuture>& pending, std::vector<TFuture>& ready)
+{
+    const auto readyCount = ready.size();
+
+    std::size_t i = 0;
+    while (i < pending.size()) {
+        if (pending[i].wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++i;
+            continue;
+        }
+
+        ready.push_back(std::move(pending[i]));
+        if (i + 1 != pending.size()) {
+            pending[i] = std::move(pending.back());
+        }
+        pending.pop_back();
+    }
+
+    return ready.size() != readyCount;
+}
+
+} // namespace detail
+} // namespace futures
+} // namespace thousandeyes
@@ -10,7 +10,9 @@
 
 #pragma once
 
+#include <future>
 #include <type_traits>
+#include <utility>
 
 namespace thousandeyes {
 namespace futures {
@@ -66,6 +68,30 @@ template <class TFunc, class TIn>
 using invoke_result_t = typename std::result_of<typename std::decay<TFunc>::type(TIn)>::type;
 #endif
 
+// is_future (an std::future or a type derived from it, e.g., a Future)
+
+template <class T>
+struct is_future :
+    std::integral_constant<
+        bool,
+        is_template<T>::value &&
+            std::is_base_of<std::future<typename nth_template_param<0, T>::type>, T>::value> {};
+
+// cont_result_t (the result of invoking a continuation on a ready std::future<TIn>)
+
+template <class TIn, class TFunc>
+using cont_result_t = invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>;
+
+// cont_future_value_t (the type of the value of the future that a continuation returns)
+
+template <class TIn, class TFunc>
+using cont_future_value_t = typename nth_template_param<0, cont_result_t<TIn, TFunc>>::type;
+
+// future_value_t (the type of the value that a std::future or std::shared_future holds)
+
+template <class TFuture>
+using future_value_t = typename std::decay<decltype(std::declval<TFuture&>().get())>::type;
+
 } // namespace detail
 } // namespace futures
 } // namespace thousandeyes
@@ -16,6 +16,8 @@
 #include <thousandeyes/futures/Default.h>
 #include <thousandeyes/futures/detail/ObservedFutureWithContinuation.h>
 #include <thousandeyes/futures/Executor.h>
+#include <thousandeyes/futures/Promise.h>
+#include <thousandeyes/futures/Waitable.h>
 
 namespace thousandeyes {
 namespace futures {
@@ -113,5 +115,107 @@ void observe(std::future<TIn> f, TFunc&& cont)
     return observe<TIn, TFunc>(std::chrono::hours(1), std::move(f), std::forward<TFunc>(cont));
 }
 
+//! \brief Observes the input #Future and calls the given continuation function once
+//! it becomes ready.
+//!
+//! \par The input #Future is not polled: the continuation is handed to the executor
+//! as soon as the associated #Promise is satisfied.
+//!
+//! \param executor The object that executes the continuation.
+//! \param f The input #Future to invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note No time limit is enforced on the input #Future. Use one of the overloads
+//! that take a time limit to poll the input future as an std::future instead.
+//!
+//! \sa Promise
+template <class TIn, class TFunc>
+void observe(std::shared_ptr<Executor> executor, Future<TIn> f, TFunc&& cont)
+{
+    auto signal = f.readySignal();
+    signal->subscribe(std::move(executor),
+                      std::make_unique<detail::ObservedFutureWithContinuation<TIn, TFunc>>(
+                          std::chrono::hours(1),
+                          std::move(f),
+                          std::forward<TFunc>(cont)));
+}
+
+//! \brief Observes the input #Future and calls the given continuation function once
+//! it becomes ready.
+//!
+//! \par This function uses the default Executor object to execute the continuation.
+//! If there isn't any default Executor object registered, this function's behavior
+//! is undefined.
+//!
+//! \param f The input #Future to invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note No time limit is enforced on the input #Future.
+//!
+//! \sa Default, Promise
+template <class TIn, class TFunc>
+void observe(Future<TIn> f, TFunc&& cont)
+{
+    observe<TIn, TFunc>(Default<Executor>(), std::move(f), std::forward<TFunc>(cont));
+}
+
+//! \brief Observes the input futures and calls the given continuation function once
+//! it becomes ready, allocating the #Waitable that waits for it with the given
+//! allocator.
+//!
+//! \param alloc The allocator to use.
+//! \param executor The object that waits for the given future to become ready.
+//! \param timeLimit The maximum time to wait for the given future to become ready.
+//! \param f The input future to wait and invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note Any exceptions from the continuation or from the executor will be thrown
+//! on the thread on which the continuation is scheduled.
+//!
+//! \sa WaitableTimedOutException
+template <class TIn, class TFunc, class TAlloc>
+void observe(std::allocator_arg_t,
+             const TAlloc& alloc,
+             std::shared_ptr<Executor> executor,
+             std::chrono::microseconds timeLimit,
+             std::future<TIn> f,
+             TFunc&& cont)
+{
+    executor->watch(std::unique_ptr<Waitable>(
+        new (std::allocator_arg, alloc) detail::ObservedFutureWithContinuation<TIn, TFunc>(
+            std::move(timeLimit),
+            std::move(f),
+            std::forward<TFunc>(cont))));
+}
+
+//! \brief Observes the input futures and calls the given continuation function once
+//! it becomes ready, allocating the #Waitable that waits for it with the given
+//! allocator.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param alloc The allocator to use.
+//! \param f The input future to wait and invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note If the total time for waiting the input future to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), an exception of
+//! type WaitableTimedOutException will be thrown on the thread on which the
+//! continuation is scheduled.
+//!
+//! \sa Default, WaitableTimedOutException
+template <class TIn, class TFunc, class TAlloc>
+void observe(std::allocator_arg_t, const TAlloc& alloc, std::future<TIn> f, TFunc&& cont)
+{
+    observe<TIn, TFunc>(std::allocator_arg,
+                        alloc,
+                        Default<Executor>(),
+                        std::chrono::hours(1),
+                        std::move(f),
+                        std::forward<TFunc>(cont));
+}
+
 } // namespace futures
 } // namespace thousandeyes
@@ -0,0 +1,208 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <thousandeyes/futures/Default.h>
+#include <thousandeyes/futures/detail/FutureWithPipeline.h>
+#include <thousandeyes/futures/Executor.h>
+#include <thousandeyes/futures/Waitable.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief A sequence of continuations (stages) to invoke on a future, which are fused
+//! into a single #Waitable.
+//!
+//! \par Pipelines are created with pipe() and extended with operator|(). Every
+//! stage is invoked on the ready future that the previous one produced, exactly like
+//! a continuation passed to then(), and may return either a value or a future. The
+//! pipeline `pipe(f) | a | b | c` produces the same result as
+//! `then(then(then(f, a), b), c)`, but it is watched by the #Executor as a single
+//! #Waitable, with a single resulting promise, and its stages run one after the other
+//! within the same dispatch, until a stage returns a future that is not ready yet.
+//!
+//! \par A stage may also take the previous stage's plain value (or nothing, after a
+//! void stage) instead of an std::future. It then gets the value without it being
+//! wrapped in a ready future, and it is skipped if a previous stage failed.
+//!
+//! \par A pipeline is submitted to its #Executor when it is converted to the
+//! resulting std::future, either implicitly or via submit().
+template <class TIn, class... TStages>
+class Pipeline {
+public:
+    //! \brief The value type of the pipeline's resulting future.
+    using Output = typename detail::pipeline_output<TIn, TStages...>::type;
+
+    Pipeline(std::shared_ptr<Executor> executor,
+             std::chrono::microseconds timeLimit,
+             std::future<TIn> f,
+             std::tuple<TStages...> stages) :
+        executor_(std::move(executor)),
+        timeLimit_(std::move(timeLimit)),
+        f_(std::move(f)),
+        stages_(std::move(stages))
+    {}
+
+    Pipeline(const Pipeline& o) = delete;
+    Pipeline& operator=(const Pipeline& o) = delete;
+
+    Pipeline(Pipeline&& o) = default;
+    Pipeline& operator=(Pipeline&& o) = default;
+
+    //! \brief Appends the given continuation to the pipeline.
+    //!
+    //! \param stage The continuation to invoke on the ready future that the
+    //! pipeline produces so far.
+    //!
+    //! \return A new pipeline that ends with the given continuation.
+    template <class TFunc>
+    Pipeline<TIn, TStages..., typename std::decay<TFunc>::type> operator|(TFunc&& stage) &&
+    {
+        return Pipeline<TIn, TStages..., typename std::decay<TFunc>::type>(
+            std::move(executor_),
+            std::move(timeLimit_),
+            std::move(f_),
+            std::tuple_cat(std::move(stages_),
+                           std::make_tuple(std::forward<TFunc>(stage))));
+    }
+
+    //! \brief Submits the pipeline to its #Executor.
+    //!
+    //! \note If the total time for waiting the futures of the pipeline to become ready
+    //! exceeds the pipeline's time limit, the resulting future becomes ready with an
+    //! exception of type WaitableTimedOutException.
+    //!
+    //! \return An std::future<Output> that contains the value produced by the
+    //! pipeline's last stage.
+    std::future<Output> submit() &&
+    {
+        std::promise<Output> p;
+
+        auto result = p.get_future();
+
+        std::weak_ptr<Executor> executor = executor_;
+        executor_->watch(
+            std::make_unique<detail::FutureWithPipeline<TIn, Output, TStages...>>(
+                std::move(timeLimit_),
+                std::move(executor),
+                std::move(f_),
+                std::move(p),
+                std::move(stages_)));
+
+        return result;
+    }
+
+    //! \brief Submits the pipeline to its #Executor.
+    //!
+    //! \sa submit()
+    operator std::future<Output>() &&
+    {
+        return std::move(*this).submit();
+    }
+
+private:
+    std::shared_ptr<Executor> executor_;
+    std::chrono::microseconds timeLimit_;
+    std::future<TIn> f_;
+    std::tuple<TStages...> stages_;
+};
+
+//! \brief Creates an empty pipeline of continuations on the given future.
+//!
+//! \param executor The object that waits for the futures of the pipeline to become ready.
+//! \param timeLimit The maximum time to wait for the futures of the pipeline to become
+//! ready.
+//! \param f The input future of the pipeline.
+//!
+//! \note If the total time for waiting the futures of the pipeline to become ready
+//! exceeds the given timeLimit, the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \sa Pipeline, then()
+//!
+//! \return A Pipeline without any stages, to which stages are appended with operator|().
+template <class TIn>
+Pipeline<TIn> pipe(std::shared_ptr<Executor> executor,
+                   std::chrono::microseconds timeLimit,
+                   std::future<TIn> f)
+{
+    return Pipeline<TIn>(std::move(executor), std::move(timeLimit), std::move(f), {});
+}
+
+//! \brief Creates an empty pipeline of continuations on the given future.
+//!
+//! \param executor The object that waits for the futures of the pipeline to become ready.
+//! \param f The input future of the pipeline.
+//!
+//! \note If the total time for waiting the futures of the pipeline to become ready
+//! exceeds a maximum threshold defined by the library (typically 1h), the resulting
+//! future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa Pipeline, then()
+//!
+//! \return A Pipeline without any stages, to which stages are appended with operator|().
+template <class TIn>
+Pipeline<TIn> pipe(std::shared_ptr<Executor> executor, std::future<TIn> f)
+{
+    return pipe<TIn>(std::move(executor), std::chrono::hours(1), std::move(f));
+}
+
+//! \brief Creates an empty pipeline of continuations on the given future.
+//!
+//! \par This function uses the default Executor object, at the time of the call, to
+//! wait for the futures of the pipeline to become ready. If there isn't any default
+//! Executor object registered, this function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for the futures of the pipeline to become
+//! ready.
+//! \param f The input future of the pipeline.
+//!
+//! \note If the total time for waiting the futures of the pipeline to become ready
+//! exceeds the given timeLimit, the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \sa Pipeline, then(), Default
+//!
+//! \return A Pipeline without any stages, to which stages are appended with operator|().
+template <class TIn>
+Pipeline<TIn> pipe(std::chrono::microseconds timeLimit, std::future<TIn> f)
+{
+    return pipe<TIn>(Default<Executor>(), std::move(timeLimit), std::move(f));
+}
+
+//! \brief Creates an empty pipeline of continuations on the given future.
+//!
+//! \par This function uses the default Executor object, at the time of the call, to
+//! wait for the futures of the pipeline to become ready. If there isn't any default
+//! Executor object registered, this function's behavior is undefined.
+//!
+//! \param f The input future of the pipeline.
+//!
+//! \note If the total time for waiting the futures of the pipeline to become ready
+//! exceeds a maximum threshold defined by the library (typically 1h), the resulting
+//! future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa Pipeline, then(), Default
+//!
+//! \return A Pipeline without any stages, to which stages are appended with operator|().
+template <class TIn>
+Pipeline<TIn> pipe(std::future<TIn> f)
+{
+    return pipe<TIn>(Default<Executor>(), std::chrono::hours(1), std::move(f));
+}
+
+} // namespace futures
+} // namespace thousandeyes
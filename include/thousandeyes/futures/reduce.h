@@ -0,0 +1,188 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <thousandeyes/futures/Default.h>
+#include <thousandeyes/futures/detail/FutureWithReduction.h>
+#include <thousandeyes/futures/Executor.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief Creates a future that becomes ready with the result of folding all the input
+//! futures, in the order in which they become ready, into an accumulated value.
+//!
+//! \par The operation is invoked as `acc = op(std::move(acc), std::move(f))` for every
+//! input future f, as soon as it is found ready; like the continuations of then(), it
+//! receives the ready future itself, so it can also handle the exceptions of the
+//! inputs. Unlike calling then() on the result of all(), every input future is
+//! destroyed as soon as it is folded, so the results do not have to be held until
+//! the last of them becomes ready.
+//!
+//! \par The operation runs on the executor's poller, between two polls, and only the
+//! final accumulated value is dispatched. It should therefore be cheap, since it
+//! delays the polling of every other pending future.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//! \param init The initial accumulated value.
+//! \param op The operation that folds a ready input future into the accumulated value.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \note If the operation throws, the resulting future becomes ready with the same
+//! exception and the rest of the input futures are not folded.
+//!
+//! \sa all(), then(), WaitableTimedOutException
+//!
+//! \return An std::future<TAcc> with the accumulated value of all the input futures.
+template <class TContainer, class TAcc, class TOp>
+std::future<TAcc> reduce(std::shared_ptr<Executor> executor,
+                         std::chrono::microseconds timeLimit,
+                         TContainer&& futures,
+                         TAcc init,
+                         TOp&& op)
+{
+    using Container = typename std::decay<TContainer>::type;
+    using Future = typename Container::value_type;
+
+    Container input(std::forward<TContainer>(futures));
+
+    std::vector<Future> pending;
+    pending.reserve(input.size());
+    for (auto& f : input) {
+        pending.push_back(std::move(f));
+    }
+
+    std::promise<TAcc> p;
+
+    auto result = p.get_future();
+
+    executor->watch(
+        std::make_unique<detail::FutureWithReduction<Future, TAcc, typename std::decay<TOp>::type>>(
+            std::move(timeLimit),
+            std::move(pending),
+            std::move(init),
+            std::forward<TOp>(op),
+            std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready with the result of folding all the input
+//! futures, in the order in which they become ready, into an accumulated value.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//! \param init The initial accumulated value.
+//! \param op The operation that folds a ready input future into the accumulated value.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \note If the operation throws, the resulting future becomes ready with the same
+//! exception and the rest of the input futures are not folded.
+//!
+//! \sa all(), then(), WaitableTimedOutException
+//!
+//! \return An std::future<TAcc> with the accumulated value of all the input futures.
+template <class TContainer, class TAcc, class TOp>
+std::future<TAcc> reduce(std::shared_ptr<Executor> executor,
+                         TContainer&& futures,
+                         TAcc init,
+                         TOp&& op)
+{
+    return reduce<TContainer, TAcc, TOp>(std::move(executor),
+                                         std::chrono::hours(1),
+                                         std::forward<TContainer>(futures),
+                                         std::move(init),
+                                         std::forward<TOp>(op));
+}
+
+//! \brief Creates a future that becomes ready with the result of folding all the input
+//! futures, in the order in which they become ready, into an accumulated value.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for all the given futures to become ready.
+//! \param futures The container that contains all the input futures.
+//! \param init The initial accumulated value.
+//! \param op The operation that folds a ready input future into the accumulated value.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \note If the operation throws, the resulting future becomes ready with the same
+//! exception and the rest of the input futures are not folded.
+//!
+//! \sa all(), then(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<TAcc> with the accumulated value of all the input futures.
+template <class TContainer, class TAcc, class TOp>
+std::future<TAcc> reduce(std::chrono::microseconds timeLimit,
+                         TContainer&& futures,
+                         TAcc init,
+                         TOp&& op)
+{
+    return reduce<TContainer, TAcc, TOp>(Default<Executor>(),
+                                         std::move(timeLimit),
+                                         std::forward<TContainer>(futures),
+                                         std::move(init),
+                                         std::forward<TOp>(op));
+}
+
+//! \brief Creates a future that becomes ready with the result of folding all the input
+//! futures, in the order in which they become ready, into an accumulated value.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param futures The container that contains all the input futures.
+//! \param init The initial accumulated value.
+//! \param op The operation that folds a ready input future into the accumulated value.
+//!
+//! \note If the total time for waiting the input futures to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \note If the operation throws, the resulting future becomes ready with the same
+//! exception and the rest of the input futures are not folded.
+//!
+//! \sa all(), then(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<TAcc> with the accumulated value of all the input futures.
+template <class TContainer, class TAcc, class TOp>
+std::future<TAcc> reduce(TContainer&& futures,
+                         TAcc init,
+                         TOp&& op)
+{
+    return reduce<TContainer, TAcc, TOp>(Default<Executor>(),
+                                         std::chrono::hours(1),
+                                         std::forward<TContainer>(futures),
+                                         std::move(init),
+                                         std::forward<TOp>(op));
+}
+
+} // namespace futures
+} // namespace thousandeyes
@@ -19,21 +19,17 @@
 #include <thousandeyes/futures/detail/FutureWithContinuation.h>
 #include <thousandeyes/futures/detail/typetraits.h>
 #include <thousandeyes/futures/Executor.h>
+#include <thousandeyes/futures/Promise.h>
+#include <thousandeyes/futures/Waitable.h>
 
 namespace thousandeyes {
 namespace futures {
 
 //! \brief SFINAE meta-type that resolves to the continuation's return type.
 template <class TIn, class TFunc>
-using cont_returns_value_t = typename std::enable_if<
-    !detail::is_template<
-        detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>>::value ||
-        !std::is_same<
-            std::future<typename detail::nth_template_param<
-                0,
-                detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>>::type>,
-            detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>>::value,
-    std::future<detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>>>::type;
+using cont_returns_value_t =
+    typename std::enable_if<!detail::is_future<detail::cont_result_t<TIn, TFunc>>::value,
+                            std::future<detail::cont_result_t<TIn, TFunc>>>::type;
 
 //! \brief Creates a future that becomes ready when the input future becomes ready.
 //!
@@ -156,17 +152,73 @@ cont_returns_value_t<TIn, TFunc> then(std::future<TIn> f, TFunc&& cont)
     return then<TIn, TFunc>(std::chrono::hours(1), std::move(f), std::forward<TFunc>(cont));
 }
 
-//! \brief SFINAE meta-type that resolves to the continuation's return future type.
+//! \brief Creates a future that becomes ready when the input #Future becomes ready.
+//!
+//! \par The resulting future contains the value returned by invoking the given
+//! continuation function. The input #Future is not polled: the continuation is
+//! handed to the executor as soon as the associated #Promise is satisfied.
+//!
+//! \param executor The object that executes the continuation.
+//! \param f The input #Future to invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note No time limit is enforced on the input #Future. Use one of the overloads
+//! that take a time limit to poll the input future as an std::future instead.
+//!
+//! \sa Promise
+//!
+//! \return An std::future<value> that contains the value returned by the given
+//! continuation function.
+template <class TIn, class TFunc>
+cont_returns_value_t<TIn, TFunc> then(std::shared_ptr<Executor> executor,
+                                      Future<TIn> f,
+                                      TFunc&& cont)
+{
+    using TOut = detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>;
+
+    std::promise<TOut> p;
+
+    auto result = p.get_future();
+
+    auto signal = f.readySignal();
+    signal->subscribe(executor,
+                      std::make_unique<detail::FutureWithContinuation<TIn, TOut, TFunc>>(
+                          std::chrono::hours(1),
+                          std::move(f),
+                          std::move(p),
+                          std::forward<TFunc>(cont)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when the input #Future becomes ready.
+//!
+//! \par The resulting future contains the value returned by invoking the given
+//! continuation function. This function uses the default Executor object to
+//! execute the continuation. If there isn't any default Executor object registered,
+//! this function's behavior is undefined.
+//!
+//! \param f The input #Future to invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note No time limit is enforced on the input #Future.
+//!
+//! \sa Default, Promise
+//!
+//! \return An std::future<value> that contains the value returned by the given
+//! continuation function.
 template <class TIn, class TFunc>
-using cont_returns_future_t = typename std::enable_if<
-    detail::is_template<
-        detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>>::value &&
-        std::is_same<
-            std::future<typename detail::nth_template_param<
-                0,
-                detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>>::type>,
-            detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>>::value,
-    detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>>::type;
+cont_returns_value_t<TIn, TFunc> then(Future<TIn> f, TFunc&& cont)
+{
+    return then<TIn, TFunc>(Default<Executor>(), std::move(f), std::forward<TFunc>(cont));
+}
+
+//! \brief SFINAE meta-type that resolves to the std::future type of the future that
+//! the continuation returns (which may also be a #Future).
+template <class TIn, class TFunc>
+using cont_returns_future_t =
+    typename std::enable_if<detail::is_future<detail::cont_result_t<TIn, TFunc>>::value,
+                            std::future<detail::cont_future_value_t<TIn, TFunc>>>::type;
 
 //! \brief Creates a future that becomes ready when both the input future and the
 //! continuation future become ready.
@@ -298,5 +350,237 @@ cont_returns_future_t<TIn, TFunc> then(std::future<TIn> f, TFunc&& cont)
     return then<TIn, TFunc>(std::chrono::hours(1), std::move(f), std::forward<TFunc>(cont));
 }
 
+//! \brief Creates a future that becomes ready when both the input #Future and the
+//! continuation future become ready.
+//!
+//! \par The resulting future contains the value contained in the future obtained
+//! by invoking the given continuation function on the ready input future. The input
+//! #Future is not polled: the continuation is handed to the executor as soon as the
+//! associated #Promise is satisfied, while the continuation future is polled as usual.
+//!
+//! \param executor The object that executes the continuation and waits for the
+//! continuation future to become ready.
+//! \param f The input #Future to invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note No time limit is enforced on the input #Future. If the time for waiting the
+//! continuation future to become ready exceeds a maximum threshold defined by the
+//! library (typically 1h), the resulting future becomes ready with an exception of
+//! type WaitableTimedOutException.
+//!
+//! \sa Promise, WaitableTimedOutException
+//!
+//! \return An std::future<value> that contains the value contained in the future
+//! returned by the given continuation function.
+template <class TIn, class TFunc>
+cont_returns_future_t<TIn, TFunc> then(std::shared_ptr<Executor> executor,
+                                       Future<TIn> f,
+                                       TFunc&& cont)
+{
+    using TOut = typename detail::nth_template_param<
+        0,
+        detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>>::type;
+
+    std::promise<TOut> p;
+
+    auto result = p.get_future();
+
+    auto signal = f.readySignal();
+    signal->subscribe(executor,
+                      std::make_unique<detail::FutureWithChaining<TIn, TOut, TFunc>>(
+                          std::chrono::hours(1),
+                          executor,
+                          std::move(f),
+                          std::move(p),
+                          std::forward<TFunc>(cont)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when both the input #Future and the
+//! continuation future become ready.
+//!
+//! \par The resulting future contains the value contained in the future obtained
+//! by invoking the given continuation function on the ready input future. This
+//! function uses the default Executor object to execute the continuation. If there
+//! isn't any default Executor object registered, this function's behavior is
+//! undefined.
+//!
+//! \param f The input #Future to invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note No time limit is enforced on the input #Future.
+//!
+//! \sa Default, Promise
+//!
+//! \return An std::future<value> that contains the value contained in the future
+//! returned by the given continuation function.
+template <class TIn, class TFunc>
+cont_returns_future_t<TIn, TFunc> then(Future<TIn> f, TFunc&& cont)
+{
+    return then<TIn, TFunc>(Default<Executor>(), std::move(f), std::forward<TFunc>(cont));
+}
+
+//! \brief Creates a future that becomes ready when the input future becomes ready,
+//! allocating everything it needs with the given allocator.
+//!
+//! \par The given allocator is used for the shared state of the resulting future and
+//! for the #Waitable that waits for the input future, so that, e.g., a request-scoped
+//! arena can back a whole graph of continuations. A std::pmr::polymorphic_allocator
+//! can be passed to allocate from a std::pmr::memory_resource.
+//!
+//! \param alloc The allocator to use.
+//! \param executor The object that waits for the given future to become ready.
+//! \param timeLimit The maximum time to wait for the given future to become ready.
+//! \param f The input future to wait and invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note If the total time for waiting the input future to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa WaitableTimedOutException
+//!
+//! \return An std::future<value> that contains the value returned by the given
+//! continuation function.
+template <class TIn, class TFunc, class TAlloc>
+cont_returns_value_t<TIn, TFunc> then(std::allocator_arg_t,
+                                      const TAlloc& alloc,
+                                      std::shared_ptr<Executor> executor,
+                                      std::chrono::microseconds timeLimit,
+                                      std::future<TIn> f,
+                                      TFunc&& cont)
+{
+    using TOut = detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>;
+
+    std::promise<TOut> p(std::allocator_arg, alloc);
+
+    auto result = p.get_future();
+
+    executor->watch(std::unique_ptr<Waitable>(
+        new (std::allocator_arg, alloc) detail::FutureWithContinuation<TIn, TOut, TFunc>(
+            std::move(timeLimit),
+            std::move(f),
+            std::move(p),
+            std::forward<TFunc>(cont))));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when the input future becomes ready,
+//! allocating everything it needs with the given allocator.
+//!
+//! \par This function uses the default Executor object to wait for the given future
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param alloc The allocator to use.
+//! \param f The input future to wait and invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note If the total time for waiting the input future to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa Default, WaitableTimedOutException
+//!
+//! \return An std::future<value> that contains the value returned by the given
+//! continuation function.
+template <class TIn, class TFunc, class TAlloc>
+cont_returns_value_t<TIn, TFunc> then(std::allocator_arg_t,
+                                      const TAlloc& alloc,
+                                      std::future<TIn> f,
+                                      TFunc&& cont)
+{
+    return then<TIn, TFunc>(std::allocator_arg,
+                            alloc,
+                            Default<Executor>(),
+                            std::chrono::hours(1),
+                            std::move(f),
+                            std::forward<TFunc>(cont));
+}
+
+//! \brief Creates a future that becomes ready when both the input future and the
+//! continuation future become ready, allocating everything it needs with the given
+//! allocator.
+//!
+//! \par The given allocator is used for the shared state of the resulting future and
+//! for the #Waitable that waits for the input future.
+//!
+//! \param alloc The allocator to use.
+//! \param executor The object that waits for the futures to become ready.
+//! \param timeLimit The maximum time to wait for both futures to become ready.
+//! \param f The input future to wait and invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note If the total time for waiting the futures to become ready exceeds the
+//! given timeLimit, the resulting future becomes ready with an exception of type
+//! WaitableTimedOutException.
+//!
+//! \sa WaitableTimedOutException
+//!
+//! \return An std::future<value> that contains the value contained in the future
+//! returned by the given continuation function.
+template <class TIn, class TFunc, class TAlloc>
+cont_returns_future_t<TIn, TFunc> then(std::allocator_arg_t,
+                                       const TAlloc& alloc,
+                                       std::shared_ptr<Executor> executor,
+                                       std::chrono::microseconds timeLimit,
+                                       std::future<TIn> f,
+                                       TFunc&& cont)
+{
+    using TOut = typename detail::nth_template_param<
+        0,
+        detail::invoke_result_t<typename std::decay<TFunc>::type, std::future<TIn>>>::type;
+
+    std::promise<TOut> p(std::allocator_arg, alloc);
+
+    auto result = p.get_future();
+
+    executor->watch(std::unique_ptr<Waitable>(
+        new (std::allocator_arg, alloc) detail::FutureWithChaining<TIn, TOut, TFunc>(
+            std::move(timeLimit),
+            executor,
+            std::move(f),
+            std::move(p),
+            std::forward<TFunc>(cont))));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when both the input future and the
+//! continuation future become ready, allocating everything it needs with the given
+//! allocator.
+//!
+//! \par This function uses the default Executor object to wait for the futures
+//! to become ready. If there isn't any default Executor object registered,
+//! this function's behavior is undefined.
+//!
+//! \param alloc The allocator to use.
+//! \param f The input future to wait and invoke the continuation function on.
+//! \param cont The continuation function to invoke on the ready input future.
+//!
+//! \note If the total time for waiting the input future to become ready exceeds
+//! a maximum threshold defined by the library (typically 1h), the resulting future
+//! becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa Default, WaitableTimedOutException
+//!
+//! \return An std::future<value> that contains the value contained in the future
+//! returned by the given continuation function.
+template <class TIn, class TFunc, class TAlloc>
+cont_returns_future_t<TIn, TFunc> then(std::allocator_arg_t,
+                                       const TAlloc& alloc,
+                                       std::future<TIn> f,
+                                       TFunc&& cont)
+{
+    return then<TIn, TFunc>(std::allocator_arg,
+                            alloc,
+                            Default<Executor>(),
+                            std::chrono::hours(1),
+                            std::move(f),
+                            std::forward<TFunc>(cont));
+}
+
 } // namespace futures
 } // namespace thousandeyes
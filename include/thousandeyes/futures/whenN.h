@@ -0,0 +1,158 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <thousandeyes/futures/Default.h>
+#include <thousandeyes/futures/detail/FutureWithQuorum.h>
+#include <thousandeyes/futures/Executor.h>
+
+namespace thousandeyes {
+namespace futures {
+
+//! \brief The type of the resulting future of whenN() for the given container.
+template <class TContainer>
+using when_n_result_t = std::future<
+    typename detail::FutureWithQuorum<typename std::decay<TContainer>::type>::Result>;
+
+//! \brief Creates a future that becomes ready when n of the input futures succeed.
+//!
+//! \par The resulting future becomes ready as soon as n of the futures in the given
+//! container become ready with a value, and the rest of them are not waited for. The
+//! futures that become ready with an exception do not count towards n.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param timeLimit The maximum time to wait for n of the given futures to succeed.
+//! \param n The number of the futures that have to succeed.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If n of the input futures do not succeed within the given timeLimit, the
+//! resulting future becomes ready with an exception of type WaitableTimedOutException.
+//! If so many of the input futures fail that n of them can no longer succeed, it
+//! becomes ready with the exception of the last one that failed. If n exceeds the
+//! number of the input futures, the resulting future becomes ready right away with an
+//! exception of type std::invalid_argument.
+//!
+//! \sa all(), any(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::vector, std::vector, std::vector>> where the
+//! first vector contains exactly n futures that hold a value, in the order they were
+//! found ready, the second one contains the input futures that were not found ready,
+//! in their original order, and the third one contains the futures that hold an
+//! exception, in the order they were found ready.
+template <class TContainer>
+when_n_result_t<TContainer> whenN(std::shared_ptr<Executor> executor,
+                                  std::chrono::microseconds timeLimit,
+                                  std::size_t n,
+                                  TContainer&& futures)
+{
+    using Result = typename detail::FutureWithQuorum<TContainer>::Result;
+
+    std::promise<Result> p;
+
+    auto result = p.get_future();
+
+    if (n > static_cast<std::size_t>(std::distance(std::begin(futures), std::end(futures)))) {
+        p.set_exception(
+            std::make_exception_ptr(std::invalid_argument("Not enough futures for the quorum")));
+        return result;
+    }
+
+    executor->watch(std::make_unique<detail::FutureWithQuorum<TContainer>>(
+        std::move(timeLimit), n, std::forward<TContainer>(futures), std::move(p)));
+
+    return result;
+}
+
+//! \brief Creates a future that becomes ready when n of the input futures succeed.
+//!
+//! \param executor The object that waits for the given futures to become ready.
+//! \param n The number of the futures that have to succeed.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If n of the input futures do not succeed within a maximum threshold defined
+//! by the library (typically 1h), the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \sa all(), any(), WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::vector, std::vector, std::vector>> with the
+//! n futures that succeeded, the ones that were not found ready and the ones that failed.
+template <class TContainer>
+when_n_result_t<TContainer> whenN(std::shared_ptr<Executor> executor,
+                                  std::size_t n,
+                                  TContainer&& futures)
+{
+    return whenN<TContainer>(std::move(executor),
+                             std::chrono::hours(1),
+                             n,
+                             std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready when n of the input futures succeed.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param timeLimit The maximum time to wait for n of the given futures to succeed.
+//! \param n The number of the futures that have to succeed.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If n of the input futures do not succeed within the given timeLimit, the
+//! resulting future becomes ready with an exception of type WaitableTimedOutException.
+//!
+//! \sa all(), any(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::vector, std::vector, std::vector>> with the
+//! n futures that succeeded, the ones that were not found ready and the ones that failed.
+template <class TContainer>
+when_n_result_t<TContainer> whenN(std::chrono::microseconds timeLimit,
+                                  std::size_t n,
+                                  TContainer&& futures)
+{
+    return whenN<TContainer>(Default<Executor>(),
+                             std::move(timeLimit),
+                             n,
+                             std::forward<TContainer>(futures));
+}
+
+//! \brief Creates a future that becomes ready when n of the input futures succeed.
+//!
+//! \par This function uses the default Executor object to wait for the given futures
+//! to become ready. If there isn't any default Executor object registered, this
+//! function's behavior is undefined.
+//!
+//! \param n The number of the futures that have to succeed.
+//! \param futures The container that contains all the input futures.
+//!
+//! \note If n of the input futures do not succeed within a maximum threshold defined
+//! by the library (typically 1h), the resulting future becomes ready with an exception
+//! of type WaitableTimedOutException.
+//!
+//! \sa all(), any(), Default, WaitableTimedOutException
+//!
+//! \return An std::future<std::tuple<std::vector, std::vector, std::vector>> with the
+//! n futures that succeeded, the ones that were not found ready and the ones that failed.
+template <class TContainer>
+when_n_result_t<TContainer> whenN(std::size_t n, TContainer&& futures)
+{
+    return whenN<TContainer>(std::chrono::hours(1), n, std::forward<TContainer>(futures));
+}
+
+} // namespace futures
+} // namespace thousandeyes
@@ -0,0 +1,221 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/all.h>
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/observe.h>
+#include <thousandeyes/futures/then.h>
+#include <thousandeyes/futures/util.h>
+
+using std::allocator_arg;
+using std::atomic;
+using std::future;
+using std::make_shared;
+using std::make_tuple;
+using std::move;
+using std::promise;
+using std::shared_ptr;
+using std::string;
+using std::to_string;
+using std::tuple;
+using std::vector;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+using thousandeyes::futures::all;
+using thousandeyes::futures::Default;
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::fromValue;
+using thousandeyes::futures::observe;
+using thousandeyes::futures::then;
+
+using ::testing::Test;
+
+namespace {
+
+struct Counters {
+    atomic<int> allocations{0};
+    atomic<int> deallocations{0};
+};
+
+template <class T>
+class CountingAllocator {
+public:
+    using value_type = T;
+
+    explicit CountingAllocator(shared_ptr<Counters> counters) : counters_(move(counters))
+    {}
+
+    template <class U>
+    CountingAllocator(const CountingAllocator<U>& o) : counters_(o.counters())
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        ++counters_->allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        ++counters_->deallocations;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    const shared_ptr<Counters>& counters() const
+    {
+        return counters_;
+    }
+
+    template <class U>
+    bool operator==(const CountingAllocator<U>& o) const
+    {
+        return counters_ == o.counters();
+    }
+
+    template <class U>
+    bool operator!=(const CountingAllocator<U>& o) const
+    {
+        return !(*this == o);
+    }
+
+private:
+    shared_ptr<Counters> counters_;
+};
+
+} // namespace
+
+class AllocatorTest : public Test {
+public:
+    AllocatorTest() :
+        counters_(make_shared<Counters>()),
+        executor_(make_shared<DefaultExecutor>(milliseconds(1))),
+        execSetter_(executor_)
+    {}
+
+    ~AllocatorTest()
+    {
+        executor_->stop();
+    }
+
+protected:
+    // The dispatching thread frees the waitables right after dispatching them
+    void expectAllFreed()
+    {
+        for (int i = 0; i < 1000 && counters_->allocations != counters_->deallocations; ++i) {
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+
+        EXPECT_EQ(counters_->allocations.load(), counters_->deallocations.load());
+    }
+
+    shared_ptr<Counters> counters_;
+    shared_ptr<DefaultExecutor> executor_;
+    Default<Executor>::Setter execSetter_;
+};
+
+TEST_F(AllocatorTest, ThenAllocatesPromiseAndWaitable)
+{
+    CountingAllocator<char> alloc(counters_);
+
+    {
+        auto f = then(allocator_arg, alloc, fromValue(1821), [](future<int> f) {
+            return to_string(f.get());
+        });
+
+        EXPECT_EQ("1821", f.get());
+    }
+
+    // At least the shared state of the resulting future and the waitable
+    EXPECT_LE(2, counters_->allocations.load());
+    expectAllFreed();
+}
+
+TEST_F(AllocatorTest, ThenWithChaining)
+{
+    CountingAllocator<char> alloc(counters_);
+
+    {
+        auto f = then(allocator_arg, alloc, fromValue(1821), [](future<int> f) {
+            return fromValue(to_string(f.get()));
+        });
+
+        EXPECT_EQ("1821", f.get());
+    }
+
+    EXPECT_LE(2, counters_->allocations.load());
+    expectAllFreed();
+}
+
+TEST_F(AllocatorTest, ObserveAllocatesWaitable)
+{
+    CountingAllocator<char> alloc(counters_);
+
+    promise<int> p;
+    observe(allocator_arg, alloc, fromValue(1821), [&p](future<int> f) { p.set_value(f.get()); });
+
+    EXPECT_EQ(1821, p.get_future().get());
+
+    EXPECT_EQ(1, counters_->allocations.load());
+    expectAllFreed();
+}
+
+TEST_F(AllocatorTest, AllWithContainerTupleAndIterators)
+{
+    CountingAllocator<char> alloc(counters_);
+
+    {
+        vector<future<int>> fs;
+        fs.push_back(fromValue(1));
+        fs.push_back(fromValue(2));
+
+        auto f = all(allocator_arg, alloc, move(fs));
+        EXPECT_EQ(2U, f.get().size());
+
+        auto g = all(allocator_arg, alloc, make_tuple(fromValue(1), fromValue(string("2"))));
+        EXPECT_EQ("2", std::get<1>(g.get()).get());
+
+        vector<future<int>> hs;
+        hs.push_back(fromValue(3));
+        auto h = all(allocator_arg, alloc, hs.begin(), hs.end());
+        EXPECT_EQ(3, std::get<0>(h.get())->get());
+    }
+
+    EXPECT_LE(6, counters_->allocations.load());
+    expectAllFreed();
+}
+
+#if __has_include(<memory_resource>)
+TEST_F(AllocatorTest, ThenWithMemoryResource)
+{
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::polymorphic_allocator<char> alloc(&arena);
+
+    auto f = then(allocator_arg, alloc, fromValue(1821), [](future<int> f) { return f.get(); });
+
+    EXPECT_EQ(1821, f.get());
+}
+#endif
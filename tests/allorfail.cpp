@@ -0,0 +1,266 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/allOrFail.h>
+#include <thousandeyes/futures/detail/FailFastWithContainer.h>
+#include <thousandeyes/futures/detail/FailFastWithIterators.h>
+#include <thousandeyes/futures/detail/FailFastWithTuple.h>
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/util.h>
+
+using std::future;
+using std::future_status;
+using std::get;
+using std::make_shared;
+using std::promise;
+using std::runtime_error;
+using std::shared_future;
+using std::string;
+using std::tuple;
+using std::vector;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+using thousandeyes::futures::allOrFail;
+using thousandeyes::futures::Default;
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::fromException;
+using thousandeyes::futures::fromValue;
+using thousandeyes::futures::WaitableTimedOutException;
+using thousandeyes::futures::detail::FailFastWithContainer;
+using thousandeyes::futures::detail::FailFastWithIterators;
+using thousandeyes::futures::detail::FailFastWithTuple;
+
+using ::testing::Test;
+
+namespace {
+
+class SomeKindOfError : public runtime_error {
+public:
+    SomeKindOfError() : runtime_error("Some Kind Of Error")
+    {}
+};
+
+class AllOrFailTest : public Test {
+protected:
+    void SetUp() override
+    {
+        executor_ = make_shared<DefaultExecutor>(milliseconds(1));
+        setter_ = std::make_unique<Default<Executor>::Setter>(executor_);
+    }
+
+    void TearDown() override
+    {
+        executor_->stop();
+        setter_.reset();
+    }
+
+    std::shared_ptr<DefaultExecutor> executor_;
+    std::unique_ptr<Default<Executor>::Setter> setter_;
+};
+
+} // namespace
+
+TEST_F(AllOrFailTest, ContainerWithoutException)
+{
+    vector<promise<int>> promises(1821);
+
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto f = allOrFail(std::move(futures));
+
+    for (int i = 0; i < 1821; ++i) {
+        promises[i].set_value(i);
+    }
+
+    auto result = f.get();
+    ASSERT_EQ(1821U, result.size());
+    for (int i = 0; i < 1821; ++i) {
+        EXPECT_EQ(i, result[i].get());
+    }
+}
+
+TEST_F(AllOrFailTest, ContainerFailsWithoutWaitingForTheRest)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(never.get_future());
+    futures.push_back(fromValue(1821));
+    futures.push_back(fromException<int>(std::make_exception_ptr(SomeKindOfError())));
+
+    auto f = allOrFail(std::move(futures));
+
+    ASSERT_EQ(future_status::ready, f.wait_for(seconds(5)));
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}
+
+TEST_F(AllOrFailTest, ContainerOfVoidAndSharedFutures)
+{
+    vector<future<void>> voids;
+    voids.push_back(fromValue());
+    voids.push_back(fromValue());
+
+    vector<shared_future<string>> shared;
+    shared.push_back(fromValue(string("1821")));
+
+    auto voidResult = allOrFail(std::move(voids)).get();
+    EXPECT_NO_THROW(voidResult[0].get());
+    EXPECT_NO_THROW(voidResult[1].get());
+
+    auto sharedResult = allOrFail(std::move(shared)).get();
+    EXPECT_EQ("1821", sharedResult[0].get());
+}
+
+TEST_F(AllOrFailTest, RangeFailsWithoutWaitingForTheRest)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1821));
+    futures.push_back(never.get_future());
+    futures.push_back(fromException<int>(std::make_exception_ptr(SomeKindOfError())));
+
+    auto f = allOrFail(futures.begin(), futures.end());
+
+    ASSERT_EQ(future_status::ready, f.wait_for(seconds(5)));
+    EXPECT_THROW(f.get(), SomeKindOfError);
+
+    // The futures that hold values remain valid
+    EXPECT_EQ(1821, futures[0].get());
+}
+
+TEST_F(AllOrFailTest, RangeWithoutException)
+{
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1));
+    futures.push_back(fromValue(2));
+
+    auto range = allOrFail(futures.begin(), futures.end()).get();
+
+    int sum = 0;
+    for (auto iter = get<0>(range); iter != get<1>(range); ++iter) {
+        sum += iter->get();
+    }
+    EXPECT_EQ(3, sum);
+}
+
+TEST_F(AllOrFailTest, TupleWithoutException)
+{
+    promise<string> p;
+
+    auto f = allOrFail(fromValue(1821), p.get_future());
+
+    p.set_value("1821");
+
+    auto result = f.get();
+    EXPECT_EQ(1821, get<0>(result).get());
+    EXPECT_EQ("1821", get<1>(result).get());
+}
+
+TEST_F(AllOrFailTest, TupleFailsWithoutWaitingForTheRest)
+{
+    promise<string> never;
+
+    auto f = allOrFail(never.get_future(),
+                       fromValue(1821),
+                       fromException<bool>(std::make_exception_ptr(SomeKindOfError())));
+
+    ASSERT_EQ(future_status::ready, f.wait_for(seconds(5)));
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}
+
+TEST_F(AllOrFailTest, TimesOut)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1821));
+    futures.push_back(never.get_future());
+
+    auto f = allOrFail(milliseconds(20), std::move(futures));
+
+    EXPECT_THROW(f.get(), WaitableTimedOutException);
+}
+
+TEST(FailFastTest, ContainerStaysReadyOnceFailed)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(never.get_future());
+    futures.push_back(fromException<int>(std::make_exception_ptr(SomeKindOfError())));
+
+    promise<vector<future<int>>> p;
+    auto f = p.get_future();
+    FailFastWithContainer<vector<future<int>>> waitable(
+        seconds(5), std::move(futures), std::move(p));
+
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+
+    waitable.dispatch(nullptr);
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}
+
+TEST(FailFastTest, RangeStaysReadyOnceFailed)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(never.get_future());
+    futures.push_back(fromException<int>(std::make_exception_ptr(SomeKindOfError())));
+
+    using Iterator = vector<future<int>>::iterator;
+
+    promise<tuple<Iterator, Iterator>> p;
+    auto f = p.get_future();
+    FailFastWithIterators<Iterator> waitable(
+        seconds(5), futures.begin(), futures.end(), std::move(p));
+
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+
+    waitable.dispatch(nullptr);
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}
+
+TEST(FailFastTest, TupleStaysReadyOnceFailed)
+{
+    promise<int> never;
+
+    promise<tuple<future<int>, future<int>>> p;
+    auto f = p.get_future();
+    FailFastWithTuple<int, int> waitable(
+        seconds(5),
+        std::make_tuple(never.get_future(),
+                        fromException<int>(std::make_exception_ptr(SomeKindOfError()))),
+        std::move(p));
+
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+
+    waitable.dispatch(nullptr);
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}
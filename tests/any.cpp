@@ -0,0 +1,211 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/any.h>
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/util.h>
+
+using std::array;
+using std::future;
+using std::get;
+using std::make_shared;
+using std::promise;
+using std::string;
+using std::tuple;
+using std::vector;
+using std::chrono::hours;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+using std::chrono::steady_clock;
+
+using thousandeyes::futures::any;
+using thousandeyes::futures::Default;
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::fromValue;
+using thousandeyes::futures::WaitableTimedOutException;
+using thousandeyes::futures::detail::FirstWithContainer;
+
+using ::testing::Test;
+
+namespace {
+
+class AnyTest : public Test {
+protected:
+    void SetUp() override
+    {
+        executor_ = make_shared<DefaultExecutor>(milliseconds(1));
+        setter_ = std::make_unique<Default<Executor>::Setter>(executor_);
+    }
+
+    void TearDown() override
+    {
+        executor_->stop();
+        setter_.reset();
+    }
+
+    std::shared_ptr<DefaultExecutor> executor_;
+    std::unique_ptr<Default<Executor>::Setter> setter_;
+};
+
+} // namespace
+
+TEST_F(AnyTest, ContainerResolvesWithFirstReady)
+{
+    vector<promise<int>> promises(1821);
+
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto f = any(std::move(futures));
+
+    promises[1234].set_value(1821);
+
+    auto result = f.get();
+    ASSERT_EQ(1234U, get<0>(result));
+    EXPECT_EQ(1821, get<1>(result)[1234].get());
+    EXPECT_EQ(1821U, get<1>(result).size());
+}
+
+TEST_F(AnyTest, ContainerPrefersTheFirstOfManyReady)
+{
+    promise<string> never;
+
+    array<future<string>, 3> futures;
+    futures[0] = never.get_future();
+    futures[1] = fromValue(string("1"));
+    futures[2] = fromValue(string("2"));
+
+    auto result = any(std::move(futures)).get();
+    ASSERT_EQ(1U, get<0>(result));
+    EXPECT_EQ("1", get<1>(result)[1].get());
+}
+
+TEST_F(AnyTest, EmptyContainer)
+{
+    vector<future<int>> futures;
+
+    auto result = any(std::move(futures)).get();
+    EXPECT_EQ(0U, get<0>(result));
+    EXPECT_TRUE(get<1>(result).empty());
+}
+
+TEST_F(AnyTest, ContainerTimesOut)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(never.get_future());
+
+    auto f = any(milliseconds(20), std::move(futures));
+
+    EXPECT_THROW(f.get(), WaitableTimedOutException);
+}
+
+TEST(FirstWithContainerTest, RotatesTheFutureItBlocksOn)
+{
+    vector<promise<int>> promises(2);
+
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    promise<tuple<std::size_t, vector<future<int>>>> p;
+    auto f = p.get_future();
+
+    FirstWithContainer<vector<future<int>>> w(hours(1), std::move(futures), std::move(p));
+
+    // Blocks on the first future
+    EXPECT_FALSE(w.wait(milliseconds(1)));
+
+    std::thread t([&promises]() {
+        std::this_thread::sleep_for(milliseconds(20));
+        promises[1].set_value(1821);
+    });
+
+    // Blocks on the second future, instead of the first one that never becomes ready
+    const auto start = steady_clock::now();
+    EXPECT_TRUE(w.wait(seconds(10)));
+    EXPECT_LT(steady_clock::now() - start, seconds(5));
+
+    t.join();
+
+    w.dispatch(nullptr);
+
+    auto result = f.get();
+    EXPECT_EQ(1U, get<0>(result));
+    EXPECT_EQ(1821, get<1>(result)[1].get());
+}
+
+TEST_F(AnyTest, RangeResolvesWithFirstReady)
+{
+    promise<int> never;
+    promise<int> p;
+
+    vector<future<int>> futures;
+    futures.push_back(never.get_future());
+    futures.push_back(p.get_future());
+
+    auto f = any(futures.begin(), futures.end());
+
+    p.set_value(1821);
+
+    auto result = f.get();
+    ASSERT_EQ(1U, get<0>(result));
+    EXPECT_EQ(futures.begin() + 1, get<1>(result));
+    EXPECT_EQ(1821, get<1>(result)->get());
+}
+
+TEST_F(AnyTest, EmptyRange)
+{
+    vector<future<int>> futures;
+
+    auto result = any(futures.begin(), futures.end()).get();
+    EXPECT_EQ(0U, get<0>(result));
+    EXPECT_EQ(futures.end(), get<1>(result));
+}
+
+TEST_F(AnyTest, TupleResolvesWithFirstReady)
+{
+    promise<int> never;
+    promise<string> p;
+
+    auto f = any(never.get_future(), p.get_future());
+
+    p.set_value("1821");
+
+    auto result = f.get();
+    ASSERT_EQ(1U, get<0>(result));
+    EXPECT_EQ("1821", get<1>(get<1>(result)).get());
+}
+
+TEST_F(AnyTest, TupleTimesOut)
+{
+    promise<int> never;
+    promise<bool> neverAgain;
+
+    auto f = any(milliseconds(20), std::make_tuple(never.get_future(), neverAgain.get_future()));
+
+    EXPECT_THROW(f.get(), WaitableTimedOutException);
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/asCompleted.h>
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/util.h>
+
+using std::future;
+using std::make_shared;
+using std::make_unique;
+using std::promise;
+using std::runtime_error;
+using std::shared_future;
+using std::string;
+using std::thread;
+using std::unique_ptr;
+using std::vector;
+using std::chrono::hours;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+using std::chrono::steady_clock;
+
+using thousandeyes::futures::asCompleted;
+using thousandeyes::futures::Default;
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::fromException;
+using thousandeyes::futures::fromValue;
+using thousandeyes::futures::WaitableTimedOutException;
+using thousandeyes::futures::WaitableWaitException;
+using thousandeyes::futures::detail::CompletionState;
+using thousandeyes::futures::detail::FuturesAsCompleted;
+
+using ::testing::ElementsAre;
+using ::testing::Test;
+using ::testing::UnorderedElementsAre;
+
+namespace {
+
+class SomeKindOfError : public runtime_error {
+public:
+    SomeKindOfError() : runtime_error("Some Kind Of Error")
+    {}
+};
+
+class AsCompletedTest : public Test {
+protected:
+    void SetUp() override
+    {
+        executor_ = make_shared<DefaultExecutor>(milliseconds(1));
+        setter_ = make_unique<Default<Executor>::Setter>(executor_);
+    }
+
+    void TearDown() override
+    {
+        executor_->stop();
+        setter_.reset();
+    }
+
+    std::shared_ptr<DefaultExecutor> executor_;
+    unique_ptr<Default<Executor>::Setter> setter_;
+};
+
+} // namespace
+
+TEST_F(AsCompletedTest, HandsOutFuturesInCompletionOrder)
+{
+    vector<promise<int>> promises(3);
+
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto channel = asCompleted(std::move(futures));
+
+    vector<int> values;
+    future<int> f;
+
+    promises[2].set_value(2);
+    ASSERT_TRUE(channel.pop(f));
+    values.push_back(f.get());
+
+    promises[0].set_value(0);
+    ASSERT_TRUE(channel.pop(f));
+    values.push_back(f.get());
+
+    promises[1].set_value(1);
+    ASSERT_TRUE(channel.pop(f));
+    values.push_back(f.get());
+
+    EXPECT_FALSE(channel.pop(f));
+    EXPECT_THAT(values, ElementsAre(2, 0, 1));
+}
+
+TEST_F(AsCompletedTest, HandsOutFuturesWithExceptions)
+{
+    vector<future<int>> futures;
+    futures.push_back(fromException<int>(std::make_exception_ptr(SomeKindOfError())));
+
+    auto channel = asCompleted(executor_, std::move(futures));
+
+    future<int> f;
+    ASSERT_TRUE(channel.pop(f));
+    EXPECT_THROW(f.get(), SomeKindOfError);
+    EXPECT_FALSE(channel.pop(f));
+}
+
+TEST_F(AsCompletedTest, ManyFuturesWithMultipleConsumers)
+{
+    vector<future<int>> futures;
+    for (int i = 0; i < 1821; ++i) {
+        futures.push_back(std::async(std::launch::async, [i]() { return i; }));
+    }
+
+    auto channel = asCompleted(std::move(futures));
+
+    vector<long> sums(4, 0);
+    vector<thread> consumers;
+    for (auto& sum : sums) {
+        consumers.emplace_back([channel, &sum]() mutable {
+            future<int> f;
+            while (channel.pop(f)) {
+                sum += f.get();
+            }
+        });
+    }
+
+    for (auto& t : consumers) {
+        t.join();
+    }
+
+    EXPECT_EQ(1821L * 1820L / 2, sums[0] + sums[1] + sums[2] + sums[3]);
+}
+
+TEST_F(AsCompletedTest, SharedFutures)
+{
+    vector<shared_future<string>> futures;
+    futures.push_back(fromValue(string("1821")));
+    futures.push_back(fromValue(string("1822")));
+
+    auto channel = asCompleted(futures);
+
+    vector<string> values;
+    shared_future<string> f;
+    while (channel.pop(f)) {
+        values.push_back(f.get());
+    }
+
+    EXPECT_THAT(values, UnorderedElementsAre("1821", "1822"));
+}
+
+TEST_F(AsCompletedTest, EmptyContainer)
+{
+    auto channel = asCompleted(vector<future<int>>());
+
+    future<int> f;
+    EXPECT_FALSE(channel.pop(f));
+}
+
+TEST_F(AsCompletedTest, TimesOutAfterHandingOutTheReadyFutures)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(never.get_future());
+    futures.push_back(fromValue(1821));
+
+    auto channel = asCompleted(milliseconds(20), std::move(futures));
+
+    future<int> f;
+    ASSERT_TRUE(channel.pop(f));
+    EXPECT_EQ(1821, f.get());
+
+    EXPECT_THROW(channel.pop(f), WaitableTimedOutException);
+}
+
+TEST_F(AsCompletedTest, ThrowsWhenTheExecutorStops)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(never.get_future());
+
+    auto channel = asCompleted(std::move(futures));
+
+    executor_->stop();
+
+    future<int> f;
+    EXPECT_THROW(channel.pop(f), WaitableWaitException);
+}
+
+TEST(FuturesAsCompletedTest, RotatesTheFutureItBlocksOn)
+{
+    vector<promise<int>> promises(2);
+
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto state = make_shared<CompletionState<future<int>>>();
+
+    FuturesAsCompleted<vector<future<int>>> w(hours(1), std::move(futures), state);
+
+    // Blocks on the first future
+    EXPECT_FALSE(w.wait(milliseconds(1)));
+
+    thread t([&promises]() {
+        std::this_thread::sleep_for(milliseconds(20));
+        promises[1].set_value(1821);
+    });
+
+    // Blocks on the second future, instead of the first one that never becomes ready
+    const auto start = steady_clock::now();
+    EXPECT_FALSE(w.wait(seconds(10)));
+    EXPECT_LT(steady_clock::now() - start, seconds(5));
+
+    t.join();
+
+    future<int> f;
+    ASSERT_TRUE(state->pop(f));
+    EXPECT_EQ(1821, f.get());
+
+    promises[0].set_value(1822);
+    EXPECT_TRUE(w.wait(milliseconds(1)));
+}
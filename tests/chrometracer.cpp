@@ -0,0 +1,199 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/ChromeTracer.h>
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/detail/TraceLog.h>
+#include <thousandeyes/futures/PollingOptions.h>
+#include <thousandeyes/futures/Promise.h>
+#include <thousandeyes/futures/then.h>
+
+using std::future;
+using std::make_shared;
+using std::promise;
+using std::string;
+using std::vector;
+using std::chrono::milliseconds;
+using std::this_thread::sleep_for;
+
+using thousandeyes::futures::ChromeTracer;
+using thousandeyes::futures::PollingExecutor;
+using thousandeyes::futures::PollingOptions;
+using thousandeyes::futures::Promise;
+using thousandeyes::futures::ReadyPolicy;
+using thousandeyes::futures::then;
+using thousandeyes::futures::detail::InvokerWithNewThread;
+using thousandeyes::futures::detail::InvokerWithSingleThread;
+using thousandeyes::futures::detail::TraceBuffer;
+using thousandeyes::futures::detail::TraceEvent;
+
+using ::testing::EndsWith;
+using ::testing::HasSubstr;
+using ::testing::StartsWith;
+
+namespace {
+
+using Executor = PollingExecutor<InvokerWithNewThread, InvokerWithSingleThread, ChromeTracer>;
+
+string writeTrace()
+{
+    std::ostringstream out;
+    ChromeTracer::write(out);
+    return out.str();
+}
+
+std::size_t countOf(const string& s, const string& pattern)
+{
+    std::size_t count = 0;
+    for (auto pos = s.find(pattern); pos != string::npos; pos = s.find(pattern, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+TEST(TraceBufferTest, KeepsTheLatestEvents)
+{
+    TraceBuffer buffer;
+
+    for (std::int64_t i = 0; i < static_cast<std::int64_t>(TraceBuffer::kCapacity) + 10; ++i) {
+        buffer.record({'i', 1, "event", nullptr, 0, i, 0, i});
+    }
+
+    vector<std::int64_t> args;
+    buffer.forEach([&args](const TraceEvent& e) { args.push_back(e.arg); });
+
+    ASSERT_EQ(TraceBuffer::kCapacity, args.size());
+    EXPECT_EQ(10, args.front());
+    EXPECT_EQ(static_cast<std::int64_t>(TraceBuffer::kCapacity) + 9, args.back());
+
+    buffer.clear();
+    buffer.record({'i', 1, "event", nullptr, 0, 0, 0, 1821});
+
+    args.clear();
+    buffer.forEach([&args](const TraceEvent& e) { args.push_back(e.arg); });
+
+    EXPECT_EQ(vector<std::int64_t>{1821}, args);
+}
+
+TEST(ChromeTracerTest, RecordsTheTimelineOfAWaitable)
+{
+    PollingOptions options;
+    options.readyPolicy = ReadyPolicy::Inline;
+
+    auto executor = make_shared<Executor>(milliseconds(1), options);
+
+    ChromeTracer::clear();
+
+    // The ready future is dispatched inline, so its whole timeline is recorded
+    // before then() returns
+    promise<int> p;
+    p.set_value(1821);
+
+    auto f = then(executor, p.get_future(), [](future<int> f) { return f.get() + 1; });
+    EXPECT_EQ(1822, f.get());
+
+    auto trace = writeTrace();
+
+    EXPECT_THAT(trace, StartsWith("{\"traceEvents\":["));
+    EXPECT_THAT(trace, EndsWith("]}\n"));
+    EXPECT_THAT(trace, HasSubstr("{\"ph\":\"b\""));
+    EXPECT_THAT(trace, HasSubstr("FutureWithContinuation"));
+    EXPECT_THAT(trace, HasSubstr("\"args\":{\"deadline\":"));
+    EXPECT_THAT(trace, HasSubstr("\"name\":\"ready\""));
+    EXPECT_THAT(trace, HasSubstr("{\"ph\":\"B\""));
+    EXPECT_THAT(trace, HasSubstr("{\"ph\":\"E\""));
+    EXPECT_THAT(trace, HasSubstr("{\"ph\":\"e\""));
+
+    executor->stop();
+}
+
+TEST(ChromeTracerTest, RecordsTheSweepsOfThePoller)
+{
+    auto executor = make_shared<Executor>(milliseconds(1));
+
+    ChromeTracer::clear();
+
+    vector<promise<int>> promises(10);
+
+    vector<future<int>> results;
+    for (auto& p : promises) {
+        results.push_back(then(executor, p.get_future(), [](future<int> f) {
+            return f.get() + 1;
+        }));
+    }
+
+    for (auto& p : promises) {
+        p.set_value(1821);
+    }
+
+    for (auto& f : results) {
+        EXPECT_EQ(1822, f.get());
+    }
+
+    executor->stop();
+
+    // Let the invoker threads finish recording before reading their buffers
+    sleep_for(milliseconds(50));
+
+    auto trace = writeTrace();
+
+    EXPECT_THAT(trace, HasSubstr("\"name\":\"sweep\""));
+    EXPECT_THAT(trace, HasSubstr("\"args\":{\"pending\":"));
+    EXPECT_THAT(trace, HasSubstr("\"name\":\"wait\""));
+    EXPECT_THAT(trace, HasSubstr("\"name\":\"dispatch\""));
+}
+
+TEST(ChromeTracerTest, PairsTheSlicesOfPushedWaitables)
+{
+    auto executor = make_shared<Executor>(milliseconds(1));
+
+    ChromeTracer::clear();
+
+    // The continuations are pushed to the executor through Executor::ready(),
+    // without ever being watched
+    vector<Promise<int>> promises(3);
+
+    vector<future<int>> results;
+    for (auto& p : promises) {
+        results.push_back(then(executor, p.get_future(), [](future<int> f) {
+            return f.get() + 1;
+        }));
+    }
+
+    for (auto& p : promises) {
+        p.set_value(1821);
+    }
+
+    for (auto& f : results) {
+        EXPECT_EQ(1822, f.get());
+    }
+
+    executor->stop();
+
+    // Let the invoker threads finish recording before reading their buffers
+    sleep_for(milliseconds(50));
+
+    auto trace = writeTrace();
+
+    EXPECT_EQ(3U, countOf(trace, "{\"ph\":\"e\""));
+    EXPECT_EQ(countOf(trace, "{\"ph\":\"e\""), countOf(trace, "{\"ph\":\"b\""));
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/collect.h>
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/util.h>
+
+using std::future;
+using std::get;
+using std::make_shared;
+using std::make_tuple;
+using std::make_unique;
+using std::promise;
+using std::runtime_error;
+using std::shared_future;
+using std::string;
+using std::tuple;
+using std::unique_ptr;
+using std::vector;
+using std::chrono::milliseconds;
+
+using thousandeyes::futures::collect;
+using thousandeyes::futures::CollectPolicy;
+using thousandeyes::futures::Default;
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::fromException;
+using thousandeyes::futures::fromValue;
+using thousandeyes::futures::WaitableTimedOutException;
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::Pointee;
+using ::testing::Test;
+
+namespace {
+
+class SomeKindOfError : public runtime_error {
+public:
+    SomeKindOfError() : runtime_error("Some Kind Of Error")
+    {}
+};
+
+class OtherKindOfError : public runtime_error {
+public:
+    OtherKindOfError() : runtime_error("Other Kind Of Error")
+    {}
+};
+
+class CollectTest : public Test {
+protected:
+    void SetUp() override
+    {
+        executor_ = make_shared<DefaultExecutor>(milliseconds(1));
+        setter_ = make_unique<Default<Executor>::Setter>(executor_);
+    }
+
+    void TearDown() override
+    {
+        executor_->stop();
+        setter_.reset();
+    }
+
+    std::shared_ptr<DefaultExecutor> executor_;
+    unique_ptr<Default<Executor>::Setter> setter_;
+};
+
+} // namespace
+
+TEST_F(CollectTest, ContainerWithoutException)
+{
+    vector<promise<int>> promises(1821);
+
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto f = collect(std::move(futures));
+
+    for (int i = 0; i < 1821; ++i) {
+        promises[i].set_value(i);
+    }
+
+    vector<int> result = f.get();
+    ASSERT_EQ(1821U, result.size());
+    for (int i = 0; i < 1821; ++i) {
+        EXPECT_EQ(i, result[i]);
+    }
+}
+
+TEST_F(CollectTest, ContainerRethrowsTheFirstException)
+{
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1821));
+    futures.push_back(fromException<int>(std::make_exception_ptr(SomeKindOfError())));
+    futures.push_back(fromException<int>(std::make_exception_ptr(OtherKindOfError())));
+
+    auto f = collect(std::move(futures));
+
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}
+
+TEST_F(CollectTest, ContainerSkipsFailed)
+{
+    vector<future<int>> futures;
+    futures.push_back(fromException<int>(std::make_exception_ptr(SomeKindOfError())));
+    futures.push_back(fromValue(1821));
+    futures.push_back(fromException<int>(std::make_exception_ptr(OtherKindOfError())));
+    futures.push_back(fromValue(1822));
+
+    auto f = collect<CollectPolicy::SkipFailed>(std::move(futures));
+
+    EXPECT_THAT(f.get(), ElementsAre(1821, 1822));
+}
+
+TEST_F(CollectTest, ContainerOfMoveOnlyValues)
+{
+    vector<future<unique_ptr<int>>> futures;
+    futures.push_back(fromValue(make_unique<int>(1821)));
+    futures.push_back(fromValue(make_unique<int>(1822)));
+
+    auto f = collect(executor_, std::move(futures));
+
+    EXPECT_THAT(f.get(), ElementsAre(Pointee(1821), Pointee(1822)));
+}
+
+TEST_F(CollectTest, ContainerOfSharedFutures)
+{
+    vector<shared_future<string>> futures;
+    futures.push_back(fromValue(string("1821")));
+    futures.push_back(futures[0]);
+
+    auto f = collect(futures);
+
+    EXPECT_THAT(f.get(), ElementsAre("1821", "1821"));
+
+    // The input container is copied, so its futures remain valid
+    EXPECT_EQ("1821", futures[1].get());
+}
+
+TEST_F(CollectTest, ContainerOfVoidFutures)
+{
+    vector<future<void>> futures;
+    futures.push_back(fromValue());
+    futures.push_back(fromException<void>(std::make_exception_ptr(SomeKindOfError())));
+
+    future<void> f = collect(std::move(futures));
+
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}
+
+TEST_F(CollectTest, RangeOfVoidFuturesSkipsFailed)
+{
+    vector<future<void>> futures;
+    futures.push_back(fromException<void>(std::make_exception_ptr(SomeKindOfError())));
+    futures.push_back(fromValue());
+
+    future<void> f = collect<CollectPolicy::SkipFailed>(futures.begin(), futures.end());
+
+    EXPECT_NO_THROW(f.get());
+}
+
+TEST_F(CollectTest, EmptyContainer)
+{
+    auto f = collect(vector<future<int>>());
+
+    EXPECT_THAT(f.get(), IsEmpty());
+}
+
+TEST_F(CollectTest, Range)
+{
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1));
+    futures.push_back(fromException<int>(std::make_exception_ptr(SomeKindOfError())));
+    futures.push_back(fromValue(2));
+
+    auto f = collect<CollectPolicy::SkipFailed>(futures.begin(), futures.end());
+    EXPECT_THAT(f.get(), ElementsAre(1, 2));
+
+    vector<future<string>> failed;
+    failed.push_back(fromException<string>(std::make_exception_ptr(SomeKindOfError())));
+
+    auto g = collect(milliseconds(100), failed.begin(), failed.end());
+    EXPECT_THROW(g.get(), SomeKindOfError);
+}
+
+TEST_F(CollectTest, Tuple)
+{
+    promise<string> p;
+
+    auto f = collect(make_tuple(fromValue(1821), p.get_future(), fromValue(true)));
+
+    p.set_value("1821");
+
+    tuple<int, string, bool> result = f.get();
+    EXPECT_EQ(1821, get<0>(result));
+    EXPECT_EQ("1821", get<1>(result));
+    EXPECT_TRUE(get<2>(result));
+}
+
+TEST_F(CollectTest, TupleRethrowsTheFirstException)
+{
+    auto f = collect(make_tuple(fromValue(1821),
+                                fromException<bool>(std::make_exception_ptr(SomeKindOfError())),
+                                fromException<int>(std::make_exception_ptr(OtherKindOfError()))));
+
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}
+
+TEST_F(CollectTest, TimesOut)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1821));
+    futures.push_back(never.get_future());
+
+    auto f = collect(milliseconds(20), std::move(futures));
+
+    EXPECT_THROW(f.get(), WaitableTimedOutException);
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/detail/FutureWithContainer.h>
+#include <thousandeyes/futures/detail/FutureWithIterators.h>
+#include <thousandeyes/futures/detail/FutureWithTuple.h>
+
+using std::future;
+using std::make_shared;
+using std::promise;
+using std::shared_ptr;
+using std::tuple;
+using std::vector;
+using std::chrono::hours;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+using thousandeyes::futures::detail::FutureWithContainer;
+using thousandeyes::futures::detail::FutureWithIterators;
+using thousandeyes::futures::detail::FutureWithTuple;
+
+using ::testing::ElementsAre;
+
+namespace {
+
+//! A future-like object that counts how many times it has been waited on.
+class CountingFuture {
+public:
+    explicit CountingFuture(bool isReady) : state_(make_shared<State>())
+    {
+        state_->isReady = isReady;
+    }
+
+    template <class TTimePoint>
+    std::future_status wait_until(const TTimePoint& /* deadline */) const
+    {
+        ++state_->waitCount;
+        return state_->isReady ? std::future_status::ready : std::future_status::timeout;
+    }
+
+    void setReady()
+    {
+        state_->isReady = true;
+    }
+
+    int waitCount() const
+    {
+        return state_->waitCount;
+    }
+
+private:
+    struct State {
+        bool isReady{false};
+        int waitCount{0};
+    };
+
+    shared_ptr<State> state_;
+};
+
+} // namespace
+
+TEST(CompositeWaitablesTest, ContainerSkipsFuturesFoundReady)
+{
+    vector<CountingFuture> futures{
+        CountingFuture(true), CountingFuture(true), CountingFuture(false)};
+    vector<CountingFuture> observed = futures;
+
+    promise<vector<CountingFuture>> p;
+    FutureWithContainer<vector<CountingFuture>> waitable(
+        hours(1), std::move(futures), std::move(p));
+
+    EXPECT_FALSE(waitable.timedWait(microseconds(0)));
+    EXPECT_FALSE(waitable.timedWait(microseconds(0)));
+
+    observed[2].setReady();
+
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+
+    EXPECT_EQ(1, observed[0].waitCount());
+    EXPECT_EQ(1, observed[1].waitCount());
+    EXPECT_EQ(3, observed[2].waitCount());
+}
+
+TEST(CompositeWaitablesTest, RangeSkipsFuturesFoundReady)
+{
+    vector<CountingFuture> futures{
+        CountingFuture(true), CountingFuture(false), CountingFuture(false)};
+
+    promise<std::tuple<vector<CountingFuture>::iterator, vector<CountingFuture>::iterator>> p;
+    FutureWithIterators<vector<CountingFuture>::iterator> waitable(
+        hours(1), futures.begin(), futures.end(), std::move(p));
+
+    EXPECT_FALSE(waitable.timedWait(microseconds(0)));
+
+    futures[1].setReady();
+    EXPECT_FALSE(waitable.timedWait(microseconds(0)));
+
+    futures[2].setReady();
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+
+    EXPECT_EQ(1, futures[0].waitCount());
+    EXPECT_EQ(2, futures[1].waitCount());
+    EXPECT_EQ(2, futures[2].waitCount());
+}
+
+TEST(CompositeWaitablesTest, TupleResumesFromFirstFutureNotReady)
+{
+    promise<int> p0;
+    promise<bool> p1;
+
+    tuple<future<int>, future<bool>> futures(p0.get_future(), p1.get_future());
+
+    promise<tuple<future<int>, future<bool>>> p;
+    auto result = p.get_future();
+
+    FutureWithTuple<int, bool> waitable(hours(1), std::move(futures), std::move(p));
+
+    EXPECT_FALSE(waitable.timedWait(microseconds(0)));
+
+    p0.set_value(1821);
+    EXPECT_FALSE(waitable.timedWait(milliseconds(1)));
+
+    p1.set_value(true);
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+
+    waitable.dispatch(nullptr);
+
+    auto ready = result.get();
+    EXPECT_EQ(1821, std::get<0>(ready).get());
+    EXPECT_TRUE(std::get<1>(ready).get());
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/Default.h>
+
+using std::make_shared;
+using std::shared_ptr;
+using std::vector;
+using std::weak_ptr;
+
+using thousandeyes::futures::Default;
+
+namespace {
+
+struct Instance {
+    explicit Instance(int id) : id(id)
+    {}
+
+    int id;
+};
+
+shared_ptr<Instance> current()
+{
+    return Default<Instance>();
+}
+
+shared_ptr<Instance> currentOnAnotherThread()
+{
+    shared_ptr<Instance> result;
+    std::thread([&result]() { result = current(); }).join();
+    return result;
+}
+
+} // namespace
+
+TEST(DefaultTest, SettersAreScoped)
+{
+    EXPECT_EQ(nullptr, current());
+
+    auto first = make_shared<Instance>(1);
+    {
+        Default<Instance>::Setter setter(first);
+        EXPECT_EQ(first, current());
+
+        auto second = make_shared<Instance>(2);
+        {
+            Default<Instance>::Setter setter(second);
+            EXPECT_EQ(second, current());
+        }
+
+        EXPECT_EQ(first, current());
+    }
+
+    EXPECT_EQ(nullptr, current());
+}
+
+TEST(DefaultTest, SettersAreVisibleToAllThreads)
+{
+    auto first = make_shared<Instance>(1);
+    Default<Instance>::Setter setter(first);
+
+    EXPECT_EQ(first, currentOnAnotherThread());
+
+    // The main thread has cached the first instance
+    EXPECT_EQ(first, current());
+
+    auto second = make_shared<Instance>(2);
+    std::thread([&second]() {
+        Default<Instance>::Setter setter(second);
+        EXPECT_EQ(second, current());
+    }).join();
+
+    EXPECT_EQ(first, current());
+}
+
+TEST(DefaultTest, DoesNotExtendTheLifetimeOfInstances)
+{
+    weak_ptr<Instance> instance;
+    {
+        auto first = make_shared<Instance>(1);
+        instance = first;
+
+        Default<Instance>::Setter setter(std::move(first));
+        EXPECT_EQ(1, current()->id);
+    }
+
+    EXPECT_TRUE(instance.expired());
+    EXPECT_EQ(nullptr, current());
+}
+
+TEST(DefaultTest, OtherThreadsReleaseInstancesOnTheirNextLookup)
+{
+    std::promise<void> looked;
+    std::promise<void> unset;
+
+    weak_ptr<Instance> instance;
+    std::thread t;
+    {
+        auto first = make_shared<Instance>(1);
+        instance = first;
+
+        Default<Instance>::Setter setter(std::move(first));
+
+        t = std::thread([&looked, unsetFuture = unset.get_future()]() mutable {
+            EXPECT_EQ(1, current()->id);
+            looked.set_value();
+
+            unsetFuture.wait();
+            EXPECT_EQ(nullptr, current());
+        });
+
+        looked.get_future().wait();
+    }
+
+    // The other thread still holds its cached reference
+    EXPECT_FALSE(instance.expired());
+
+    unset.set_value();
+    t.join();
+
+    EXPECT_TRUE(instance.expired());
+}
+
+TEST(DefaultTest, ThreadSetterOnlyAffectsTheCurrentThread)
+{
+    auto global = make_shared<Instance>(1);
+    Default<Instance>::Setter setter(global);
+
+    auto local = make_shared<Instance>(2);
+    {
+        Default<Instance>::ThreadSetter threadSetter(local);
+
+        EXPECT_EQ(local, current());
+        EXPECT_EQ(global, currentOnAnotherThread());
+    }
+
+    EXPECT_EQ(global, current());
+}
+
+TEST(DefaultTest, ConcurrentReadersAndSetters)
+{
+    auto global = make_shared<Instance>(1);
+    Default<Instance>::Setter setter(global);
+
+    // A single thread sets instances, since the Setters of the different threads
+    // would not be destroyed in the reverse order of their construction
+    vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([i]() {
+            auto local = make_shared<Instance>(i + 2);
+
+            for (int j = 0; j < 1000; ++j) {
+                if (i == 0) {
+                    Default<Instance>::Setter setter(local);
+                    EXPECT_EQ(local, current());
+                }
+                else {
+                    EXPECT_NE(nullptr, current());
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(global, current());
+}
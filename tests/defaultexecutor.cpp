@@ -77,6 +77,8 @@ using thousandeyes::futures::Executor;
 using thousandeyes::futures::fromException;
 using thousandeyes::futures::fromValue;
 using thousandeyes::futures::observe;
+using thousandeyes::futures::PollingOptions;
+using thousandeyes::futures::ReadyPolicy;
 using thousandeyes::futures::then;
 using thousandeyes::futures::Waitable;
 using thousandeyes::futures::WaitableWaitException;
@@ -174,6 +176,36 @@ TEST_F(DefaultExecutorTest, ThenWithoutException)
     executor->stop();
 }
 
+TEST_F(DefaultExecutorTest, ThenWithReadyInputRunsInline)
+{
+    PollingOptions options;
+    options.readyPolicy = ReadyPolicy::Inline;
+
+    auto executor = make_shared<DefaultExecutor>(milliseconds(10), options);
+    Default<Executor>::Setter execSetter(executor);
+
+    auto caller = std::this_thread::get_id();
+
+    auto f = then(fromValue(1821), [caller](future<int> f) {
+        EXPECT_EQ(caller, std::this_thread::get_id());
+        return to_string(f.get());
+    });
+
+    auto g = then(all(fromValue(1821), fromValue(string("1822"))),
+                  [](future<tuple<future<int>, future<string>>> f) {
+                      auto t = f.get();
+                      return to_string(get<0>(t).get()) + get<1>(t).get();
+                  });
+
+    ASSERT_EQ(future_status::ready, f.wait_for(seconds(0)));
+    ASSERT_EQ(future_status::ready, g.wait_for(seconds(0)));
+
+    EXPECT_EQ("1821", f.get());
+    EXPECT_EQ("18211822", g.get());
+
+    executor->stop();
+}
+
 TEST_F(DefaultExecutorTest, ObserveWithoutException)
 {
     auto executor = make_shared<DefaultExecutor>(milliseconds(10));
@@ -393,6 +425,54 @@ TEST_F(DefaultExecutorTest, ChainingThenWithoutException)
     executor->stop();
 }
 
+namespace {
+
+class CountingExecutor : public Executor {
+public:
+    explicit CountingExecutor(shared_ptr<Executor> executor) : executor_(move(executor))
+    {}
+
+    void watch(unique_ptr<Waitable> w) override
+    {
+        ++watchCount;
+        executor_->watch(move(w));
+    }
+
+    void stop() override
+    {
+        executor_->stop();
+    }
+
+    std::atomic<int> watchCount{0};
+
+private:
+    shared_ptr<Executor> executor_;
+};
+
+} // namespace
+
+TEST_F(DefaultExecutorTest, ChainingWithReadyOutputIsNotForwarded)
+{
+    auto executor = make_shared<CountingExecutor>(make_shared<DefaultExecutor>(milliseconds(10)));
+
+    auto f = then(executor, getValueAsync(1821), [](future<int> f) {
+        return fromValue(to_string(f.get()));
+    });
+
+    auto g = then(executor, getValueAsync(), [](future<void> f) {
+        f.get();
+        return fromException<void>(make_exception_ptr(SomeKindOfError{}));
+    });
+
+    EXPECT_EQ("1821", f.get());
+    EXPECT_THROW(g.get(), SomeKindOfError);
+
+    // Only the input futures were watched
+    EXPECT_EQ(2, executor->watchCount.load());
+
+    executor->stop();
+}
+
 TEST_F(DefaultExecutorTest, ChainingWithVoidOutputWithoutException)
 {
     auto executor = make_shared<DefaultExecutor>(milliseconds(10));
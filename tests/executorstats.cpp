@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/ExecutorStats.h>
+#include <thousandeyes/futures/PollingExecutorWithPartialSort.h>
+#include <thousandeyes/futures/then.h>
+
+using std::future;
+using std::make_shared;
+using std::promise;
+using std::vector;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+
+using thousandeyes::futures::ExecutorStats;
+using thousandeyes::futures::LatencyHistogram;
+using thousandeyes::futures::PollingExecutor;
+using thousandeyes::futures::PollingExecutorWithPartialSort;
+using thousandeyes::futures::then;
+using thousandeyes::futures::detail::InvokerWithNewThread;
+using thousandeyes::futures::detail::InvokerWithSingleThread;
+
+using ::testing::Ge;
+using ::testing::Gt;
+
+namespace {
+
+template <class TExecutor>
+void runContinuations(std::shared_ptr<TExecutor> executor, int count)
+{
+    vector<promise<int>> promises(count);
+
+    vector<future<int>> results;
+    for (auto& p : promises) {
+        results.push_back(then(executor, p.get_future(), [](future<int> f) {
+            return f.get() + 1;
+        }));
+    }
+
+    for (auto& p : promises) {
+        p.set_value(1821);
+    }
+
+    for (auto& f : results) {
+        EXPECT_EQ(1822, f.get());
+    }
+}
+
+} // namespace
+
+TEST(LatencyHistogramTest, RecordsIntoPowerOfTwoBuckets)
+{
+    LatencyHistogram histogram;
+
+    histogram.record(nanoseconds(500));
+    histogram.record(microseconds(1));
+    histogram.record(microseconds(3));
+    histogram.record(microseconds(1000));
+
+    auto s = histogram.snapshot();
+
+    EXPECT_EQ(4U, s.count);
+    EXPECT_EQ(1U, s.buckets[0]);
+    EXPECT_EQ(1U, s.buckets[1]);
+    EXPECT_EQ(1U, s.buckets[2]);
+    EXPECT_EQ(1U, s.buckets[10]);
+    EXPECT_EQ(microseconds(1000), s.max);
+    EXPECT_EQ(nanoseconds(1004500 / 4), s.mean());
+
+    EXPECT_EQ(microseconds(1), s.percentile(0));
+    EXPECT_EQ(microseconds(4), s.percentile(50));
+    EXPECT_EQ(microseconds(1024), s.percentile(100));
+}
+
+TEST(ExecutorStatsTest, PollingExecutor)
+{
+    using Executor = PollingExecutor<InvokerWithNewThread, InvokerWithSingleThread, ExecutorStats>;
+
+    auto executor = make_shared<Executor>(milliseconds(1));
+    ExecutorStats stats = executor->instrumentation();
+
+    runContinuations(executor, 100);
+
+    auto s = stats.snapshot();
+    EXPECT_EQ(100U, s.watches);
+    EXPECT_EQ(100U, s.dispatches);
+    EXPECT_EQ(100U, s.readyToDispatch.count);
+    EXPECT_THAT(s.waits, Ge(100U));
+    EXPECT_THAT(s.sweeps, Gt(0U));
+    EXPECT_EQ(s.sweeps, s.sweepDuration.count);
+    EXPECT_THAT(s.waitsPerDispatch(), Ge(1.0));
+
+    executor->stop();
+}
+
+TEST(ExecutorStatsTest, PollingExecutorWithPartialSort)
+{
+    using Executor = PollingExecutorWithPartialSort<InvokerWithNewThread,
+                                                    InvokerWithSingleThread,
+                                                    ExecutorStats>;
+
+    auto executor = make_shared<Executor>(milliseconds(1));
+    ExecutorStats stats = executor->instrumentation();
+
+    runContinuations(executor, 100);
+
+    auto s = stats.snapshot();
+    EXPECT_EQ(100U, s.watches);
+    EXPECT_EQ(100U, s.dispatches);
+    EXPECT_THAT(s.waits, Ge(100U));
+    EXPECT_THAT(s.sweeps, Gt(0U));
+
+    executor->stop();
+}
+
+TEST(ExecutorStatsTest, OutlivesTheExecutor)
+{
+    using Executor = PollingExecutor<InvokerWithNewThread, InvokerWithSingleThread, ExecutorStats>;
+
+    ExecutorStats stats;
+    {
+        auto executor = make_shared<Executor>(milliseconds(1));
+        stats = executor->instrumentation();
+
+        runContinuations(executor, 1);
+        executor->stop();
+    }
+
+    EXPECT_EQ(1U, stats.snapshot().watches);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/detail/MpscQueue.h>
+
+using std::atomic;
+using std::make_unique;
+using std::thread;
+using std::unique_ptr;
+using std::vector;
+
+using thousandeyes::futures::detail::MpscQueue;
+
+using ::testing::ElementsAre;
+
+TEST(MpscQueueTest, DrainsItemsInPushOrder)
+{
+    MpscQueue<unique_ptr<int>> queue;
+
+    EXPECT_TRUE(queue.empty());
+
+    queue.push(make_unique<int>(1));
+    queue.push(make_unique<int>(8));
+    queue.push(make_unique<int>(2));
+
+    EXPECT_FALSE(queue.empty());
+
+    vector<int> drained;
+    auto count = queue.drain([&drained](unique_ptr<int> i) { drained.push_back(*i); });
+
+    EXPECT_EQ(3U, count);
+    EXPECT_THAT(drained, ElementsAre(1, 8, 2));
+    EXPECT_TRUE(queue.empty());
+
+    EXPECT_EQ(0U, queue.drain([](unique_ptr<int> /* i */) { FAIL(); }));
+}
+
+TEST(MpscQueueTest, ConcurrentProducers)
+{
+    MpscQueue<int> queue;
+
+    const int producerCount = 4;
+    const int itemsPerProducer = 10000;
+
+    atomic<bool> done{false};
+    vector<int> lastSeen(producerCount, -1);
+    int total = 0;
+
+    auto consume = [&]() {
+        queue.drain([&](int item) {
+            int producer = item / itemsPerProducer;
+            int seq = item % itemsPerProducer;
+
+            // Items of the same producer must be drained in order
+            EXPECT_LT(lastSeen[producer], seq);
+            lastSeen[producer] = seq;
+            ++total;
+        });
+    };
+
+    thread consumer([&]() {
+        while (!done.load()) {
+            consume();
+        }
+    });
+
+    vector<thread> producers;
+    for (int p = 0; p < producerCount; ++p) {
+        producers.emplace_back([&queue, p, itemsPerProducer]() {
+            for (int i = 0; i < itemsPerProducer; ++i) {
+                queue.push(p * itemsPerProducer + i);
+            }
+        });
+    }
+
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    done.store(true);
+    consumer.join();
+    consume();
+
+    EXPECT_EQ(producerCount * itemsPerProducer, total);
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/detail/InvokerWithPersistentThread.h>
+#include <thousandeyes/futures/Waitable.h>
+
+using std::future;
+using std::make_shared;
+using std::make_unique;
+using std::promise;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Waitable;
+using thousandeyes::futures::detail::InvokerWithPersistentThread;
+
+namespace {
+
+//! Signals the given promise when the thread that owns it exits.
+class ExitSignal {
+public:
+    ~ExitSignal()
+    {
+        if (p_) {
+            p_->set_value();
+        }
+    }
+
+    void set(promise<void>* p)
+    {
+        p_ = p;
+    }
+
+private:
+    promise<void>* p_{nullptr};
+};
+
+thread_local ExitSignal exitSignal;
+
+class ThreadRecordingWaitable : public Waitable {
+public:
+    explicit ThreadRecordingWaitable(promise<std::thread::id> p) : p_(std::move(p))
+    {}
+
+    bool wait(const microseconds& /* q */) override
+    {
+        pollerId_ = std::this_thread::get_id();
+        return true;
+    }
+
+    void dispatch(std::exception_ptr /* err */) override
+    {
+        p_.set_value(pollerId_);
+    }
+
+private:
+    promise<std::thread::id> p_;
+    std::thread::id pollerId_;
+};
+
+std::thread::id runOn(InvokerWithPersistentThread& invoker)
+{
+    promise<std::thread::id> p;
+    auto result = p.get_future();
+
+    invoker([&p]() { p.set_value(std::this_thread::get_id()); });
+
+    return result.get();
+}
+
+} // namespace
+
+TEST(InvokerWithPersistentThreadTest, RunsFunctionsOnTheSameThread)
+{
+    InvokerWithPersistentThread invoker;
+
+    auto first = runOn(invoker);
+    auto second = runOn(invoker);
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(std::this_thread::get_id(), first);
+}
+
+TEST(InvokerWithPersistentThreadTest, JoinsTheThreadOnDestruction)
+{
+    promise<void> exited;
+    auto hasExited = exited.get_future();
+
+    {
+        InvokerWithPersistentThread invoker;
+
+        promise<void> ran;
+        invoker([&exited, &ran]() {
+            exitSignal.set(&exited);
+            ran.set_value();
+        });
+        ran.get_future().wait();
+    }
+
+    EXPECT_EQ(std::future_status::ready, hasExited.wait_for(seconds(0)));
+}
+
+TEST(InvokerWithPersistentThreadTest, DestroyedByItsOwnThread)
+{
+    promise<void> exited;
+    auto hasExited = exited.get_future();
+
+    auto invoker = make_shared<InvokerWithPersistentThread>();
+    (*invoker)([&exited, keep = invoker]() { exitSignal.set(&exited); });
+    invoker.reset();
+
+    EXPECT_EQ(std::future_status::ready, hasExited.wait_for(seconds(10)));
+}
+
+TEST(InvokerWithPersistentThreadTest, ExecutorRestartsThePollerOnTheSameThread)
+{
+    auto executor = make_shared<DefaultExecutor>(milliseconds(1));
+
+    promise<std::thread::id> p1;
+    auto first = p1.get_future();
+    executor->watch(make_unique<ThreadRecordingWaitable>(std::move(p1)));
+
+    auto firstId = first.get();
+
+    // Let the poller go idle, so that the next watch() restarts it
+    std::this_thread::sleep_for(milliseconds(10));
+
+    promise<std::thread::id> p2;
+    auto second = p2.get_future();
+    executor->watch(make_unique<ThreadRecordingWaitable>(std::move(p2)));
+
+    EXPECT_EQ(firstId, second.get());
+
+    executor->stop();
+}
@@ -0,0 +1,223 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/pipe.h>
+#include <thousandeyes/futures/util.h>
+
+using std::atomic;
+using std::future;
+using std::make_shared;
+using std::move;
+using std::promise;
+using std::runtime_error;
+using std::shared_ptr;
+using std::string;
+using std::to_string;
+using std::unique_ptr;
+using std::chrono::milliseconds;
+
+using thousandeyes::futures::Default;
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::fromValue;
+using thousandeyes::futures::pipe;
+using thousandeyes::futures::Waitable;
+using thousandeyes::futures::WaitableTimedOutException;
+
+using ::testing::Test;
+
+namespace {
+
+class SomeKindOfError : public runtime_error {
+public:
+    SomeKindOfError() : runtime_error("Some Kind Of Error")
+    {}
+};
+
+class CountingExecutor : public Executor {
+public:
+    explicit CountingExecutor(shared_ptr<Executor> executor) : executor_(move(executor))
+    {}
+
+    void watch(unique_ptr<Waitable> w) override
+    {
+        ++watchCount;
+        executor_->watch(move(w));
+    }
+
+    void stop() override
+    {
+        executor_->stop();
+    }
+
+    atomic<int> watchCount{0};
+
+private:
+    shared_ptr<Executor> executor_;
+};
+
+class PipeTest : public Test {
+protected:
+    PipeTest() :
+        executor_(make_shared<CountingExecutor>(make_shared<DefaultExecutor>(milliseconds(1))))
+    {}
+
+    ~PipeTest()
+    {
+        executor_->stop();
+    }
+
+    shared_ptr<CountingExecutor> executor_;
+};
+
+} // namespace
+
+TEST_F(PipeTest, FusesStagesIntoSingleWaitable)
+{
+    promise<int> p;
+
+    future<size_t> f = pipe(executor_, p.get_future()) |
+                       [](future<int> f) { return f.get() + 1; } |
+                       [](future<int> f) { return to_string(f.get()); } |
+                       [](future<string> f) { return f.get().size(); };
+
+    p.set_value(1820);
+
+    EXPECT_EQ(4U, f.get());
+    EXPECT_EQ(1, executor_->watchCount.load());
+}
+
+TEST_F(PipeTest, EmptyPipeline)
+{
+    auto f = pipe(executor_, fromValue(string("1821"))).submit();
+
+    EXPECT_EQ("1821", f.get());
+}
+
+TEST_F(PipeTest, ExceptionsReachTheNextStage)
+{
+    future<string> f = pipe(executor_, fromValue(1821)) |
+                       [](future<int> /* f */) -> int { throw SomeKindOfError(); } |
+                       [](future<int> f) {
+                           try {
+                               f.get();
+                           }
+                           catch (const SomeKindOfError&) {
+                               return string("recovered");
+                           }
+                           return string("unexpected");
+                       };
+
+    EXPECT_EQ("recovered", f.get());
+}
+
+TEST_F(PipeTest, ExceptionsOfTheLastStageReachTheResult)
+{
+    future<void> f = pipe(executor_, fromValue(1821)) | [](future<int> f) { f.get(); } |
+                     [](future<void> /* f */) { throw SomeKindOfError(); };
+
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}
+
+TEST_F(PipeTest, PassesValuesToStagesThatTakeThem)
+{
+    future<size_t> f = pipe(executor_, fromValue(1820)) | [](int v) { return v + 1; } |
+                       [](int v) { return to_string(v); } |
+                       [](future<string> f) { return f.get(); } | [](string /* s */) {} |
+                       []() { return size_t(1821); };
+
+    EXPECT_EQ(1821U, f.get());
+    EXPECT_EQ(1, executor_->watchCount.load());
+}
+
+TEST_F(PipeTest, ExceptionsSkipStagesThatTakeValues)
+{
+    bool isSkipped = true;
+
+    future<string> f = pipe(executor_, fromValue(1821)) |
+                       [](int /* v */) -> int { throw SomeKindOfError(); } |
+                       [&isSkipped](int v) {
+                           isSkipped = false;
+                           return v;
+                       } |
+                       [](future<int> f) {
+                           try {
+                               f.get();
+                           }
+                           catch (const SomeKindOfError&) {
+                               return string("recovered");
+                           }
+                           return string("unexpected");
+                       };
+
+    EXPECT_EQ("recovered", f.get());
+    EXPECT_TRUE(isSkipped);
+}
+
+TEST_F(PipeTest, WaitsForFuturesReturnedByStages)
+{
+    promise<string> inner;
+    auto innerFuture = inner.get_future().share();
+
+    future<string> f = pipe(executor_, fromValue(1821)) |
+                       [innerFuture](future<int> f) {
+                           auto value = f.get();
+                           return std::async(std::launch::async, [innerFuture, value]() {
+                               return innerFuture.get() + to_string(value);
+                           });
+                       } |
+                       [](future<string> f) { return f.get() + "!"; };
+
+    std::this_thread::sleep_for(milliseconds(20));
+    inner.set_value("#");
+
+    EXPECT_EQ("#1821!", f.get());
+
+    // The rest of the pipeline waited for the returned future in a second waitable
+    EXPECT_EQ(2, executor_->watchCount.load());
+}
+
+TEST_F(PipeTest, LastStageReturnsReadyFuture)
+{
+    future<int> f = pipe(executor_, fromValue(1820)) |
+                    [](future<int> f) { return fromValue(f.get() + 1); };
+
+    EXPECT_EQ(1821, f.get());
+    EXPECT_EQ(1, executor_->watchCount.load());
+}
+
+TEST_F(PipeTest, UsesDefaultExecutor)
+{
+    Default<Executor>::Setter execSetter(executor_);
+
+    future<string> f = pipe(fromValue(1821)) | [](future<int> f) { return to_string(f.get()); };
+
+    EXPECT_EQ("1821", f.get());
+}
+
+TEST_F(PipeTest, TimesOut)
+{
+    promise<int> never;
+
+    future<int> f =
+        pipe(executor_, milliseconds(20), never.get_future()) | [](future<int> /* f */) { return 0; };
+
+    EXPECT_THROW(f.get(), WaitableTimedOutException);
+}
@@ -8,16 +8,24 @@
  * @author Giannis Georgalis, https://github.com/ggeorgalis
  */
 
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <future>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <thousandeyes/futures/detail/InvokerWithNewThread.h>
+#include <thousandeyes/futures/detail/InvokerWithSingleThread.h>
+#include <thousandeyes/futures/detail/PendingWaitable.h>
+#include <thousandeyes/futures/ExecutorStats.h>
 #include <thousandeyes/futures/PollingExecutor.h>
+#include <thousandeyes/futures/PollingExecutorWithPartialSort.h>
 #include <thousandeyes/futures/TimedWaitable.h>
 #include <thousandeyes/futures/Waitable.h>
 
@@ -37,14 +45,27 @@ using std::chrono::milliseconds;
 using std::chrono::minutes;
 using std::chrono::seconds;
 
+using thousandeyes::futures::ExecutorStats;
+using thousandeyes::futures::PollingBackoff;
 using thousandeyes::futures::PollingExecutor;
+using thousandeyes::futures::PollingExecutorWithPartialSort;
+using thousandeyes::futures::PollingMode;
+using thousandeyes::futures::PollingOptions;
+using thousandeyes::futures::ReadyPolicy;
 using thousandeyes::futures::TimedWaitable;
+using thousandeyes::futures::toEpochTimestamp;
 using thousandeyes::futures::Waitable;
 using thousandeyes::futures::WaitableTimedOutException;
+using thousandeyes::futures::detail::InvokerWithNewThread;
+using thousandeyes::futures::detail::InvokerWithSingleThread;
+using thousandeyes::futures::detail::PendingWaitable;
 
 using ::testing::_;
 using ::testing::AtLeast;
+using ::testing::Invoke;
 using ::testing::IsNull;
+using ::testing::Lt;
+using ::testing::Mock;
 using ::testing::NotNull;
 using ::testing::Return;
 using ::testing::SaveArg;
@@ -55,11 +76,38 @@ namespace {
 
 class WaitableMock : public Waitable {
 public:
+    WaitableMock() = default;
+
+    explicit WaitableMock(milliseconds epochDeadline) : Waitable(move(epochDeadline))
+    {}
+
     MOCK_METHOD1(wait, bool(const std::chrono::microseconds& timeout));
 
     MOCK_METHOD1(dispatch, void(std::exception_ptr err));
 };
 
+class NeverReadyWaitable : public TimedWaitable {
+public:
+    NeverReadyWaitable(microseconds waitLimit, std::promise<std::exception_ptr> p) :
+        TimedWaitable(move(waitLimit)),
+        p_(move(p))
+    {}
+
+    bool timedWait(const std::chrono::microseconds& timeout) override
+    {
+        std::this_thread::sleep_for(timeout);
+        return false;
+    }
+
+    void dispatch(std::exception_ptr err) override
+    {
+        p_.set_value(move(err));
+    }
+
+private:
+    std::promise<std::exception_ptr> p_;
+};
+
 class Invoker {
 public:
     MOCK_METHOD1(invoke, void(function<void()> f));
@@ -81,8 +129,8 @@ private:
 
 class Executor : public PollingExecutor<DispatcherFunctor, DispatcherFunctor> {
 public:
-    Executor(milliseconds q, shared_ptr<Invoker> d) :
-        PollingExecutor(move(q), DispatcherFunctor(d), DispatcherFunctor(d))
+    Executor(milliseconds q, shared_ptr<Invoker> d, PollingOptions options = {}) :
+        PollingExecutor(move(q), DispatcherFunctor(d), DispatcherFunctor(d), move(options))
     {}
 };
 
@@ -133,3 +181,386 @@ TEST_F(PollingExecutorTest, ThrowingWaitable)
     f(); // Poll
     g(); // Dispatch
 }
+
+TEST_F(PollingExecutorTest, ExpiredWaitableIsCancelledWithoutBlocking)
+{
+    auto deadline = toEpochTimestamp(std::chrono::steady_clock::now()) - milliseconds(1);
+    auto waitable = make_unique<WaitableMock>(deadline);
+
+    EXPECT_CALL(*waitable, wait(microseconds(0))).WillOnce(Return(false));
+
+    std::exception_ptr error;
+    EXPECT_CALL(*waitable, dispatch(NotNull())).WillOnce(SaveArg<0>(&error));
+
+    function<void()> f, g;
+    EXPECT_CALL(*invoker_, invoke(_)).WillOnce(SaveArg<0>(&f)).WillOnce(SaveArg<0>(&g));
+
+    poller_->watch(move(waitable));
+
+    f(); // Poll
+    g(); // Dispatch
+
+    EXPECT_THROW(std::rethrow_exception(error), WaitableTimedOutException);
+}
+
+TEST_F(PollingExecutorTest, ExpiredButReadyWaitableIsDispatched)
+{
+    auto deadline = toEpochTimestamp(std::chrono::steady_clock::now()) - milliseconds(1);
+    auto waitable = make_unique<WaitableMock>(deadline);
+
+    EXPECT_CALL(*waitable, wait(microseconds(0))).WillOnce(Return(true));
+
+    EXPECT_CALL(*waitable, dispatch(IsNull())).Times(1);
+
+    function<void()> f, g;
+    EXPECT_CALL(*invoker_, invoke(_)).WillOnce(SaveArg<0>(&f)).WillOnce(SaveArg<0>(&g));
+
+    poller_->watch(move(waitable));
+
+    f(); // Poll
+    g(); // Dispatch
+}
+
+TEST_F(PollingExecutorTest, PollsNotReadyWaitableUntilReady)
+{
+    auto deadline = toEpochTimestamp(std::chrono::steady_clock::now()) + hours(1);
+    auto waitable = make_unique<WaitableMock>(deadline);
+
+    EXPECT_CALL(*waitable, wait(microseconds(10000)))
+        .WillOnce(Return(false))
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+
+    EXPECT_CALL(*waitable, dispatch(IsNull())).Times(1);
+
+    function<void()> f, g;
+    EXPECT_CALL(*invoker_, invoke(_)).WillOnce(SaveArg<0>(&f)).WillOnce(SaveArg<0>(&g));
+
+    poller_->watch(move(waitable));
+
+    f(); // Poll
+    g(); // Dispatch
+}
+
+TEST_F(PollingExecutorTest, SweepPollsWithoutBlocking)
+{
+    poller_ = make_shared<Executor>(milliseconds(1), invoker_, PollingOptions{PollingMode::Sweep});
+
+    auto waitable = make_unique<WaitableMock>();
+
+    EXPECT_CALL(*waitable, wait(microseconds(0)))
+        .WillOnce(Return(false))
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+
+    EXPECT_CALL(*waitable, dispatch(IsNull())).Times(1);
+
+    function<void()> f, g;
+    EXPECT_CALL(*invoker_, invoke(_)).WillOnce(SaveArg<0>(&f)).WillOnce(SaveArg<0>(&g));
+
+    poller_->watch(move(waitable));
+
+    f(); // Poll
+    g(); // Dispatch
+}
+
+TEST_F(PollingExecutorTest, SweepWakesUpSleepingPollerOnWatch)
+{
+    poller_ = make_shared<Executor>(hours(1), invoker_, PollingOptions{PollingMode::Sweep});
+
+    auto slowWaitable = make_unique<WaitableMock>();
+    auto readyWaitable = make_unique<WaitableMock>();
+
+    EXPECT_CALL(*slowWaitable, wait(microseconds(0))).WillRepeatedly(Return(false));
+    EXPECT_CALL(*slowWaitable, dispatch(NotNull())).Times(1);
+
+    std::promise<void> dispatched;
+    EXPECT_CALL(*readyWaitable, wait(microseconds(0))).WillOnce(Return(true));
+    EXPECT_CALL(*readyWaitable, dispatch(IsNull()))
+        .WillOnce(Invoke([&dispatched](std::exception_ptr) { dispatched.set_value(); }));
+
+    function<void()> f;
+    EXPECT_CALL(*invoker_, invoke(_))
+        .WillOnce(SaveArg<0>(&f))
+        .WillRepeatedly(Invoke([](function<void()> g) { g(); }));
+
+    poller_->watch(move(slowWaitable));
+
+    std::thread poller(f);
+
+    std::this_thread::sleep_for(milliseconds(50));
+    poller_->watch(move(readyWaitable));
+
+    EXPECT_EQ(std::future_status::ready, dispatched.get_future().wait_for(seconds(10)));
+
+    poller_->stop();
+    poller.join();
+}
+
+TEST_F(PollingExecutorTest, ReadyWaitableIsDispatchedWithoutPolling)
+{
+    poller_ = make_shared<Executor>(
+        milliseconds(10), invoker_, PollingOptions{PollingMode::Blocking, ReadyPolicy::Dispatch});
+
+    auto waitable = make_unique<WaitableMock>();
+
+    EXPECT_CALL(*waitable, wait(microseconds(0))).WillOnce(Return(true));
+
+    EXPECT_CALL(*waitable, dispatch(IsNull())).Times(1);
+
+    function<void()> g;
+    EXPECT_CALL(*invoker_, invoke(_)).WillOnce(SaveArg<0>(&g));
+
+    poller_->watch(move(waitable));
+
+    g(); // Dispatch
+}
+
+TEST_F(PollingExecutorTest, ReadyWaitableIsDispatchedInline)
+{
+    poller_ = make_shared<Executor>(
+        milliseconds(10), invoker_, PollingOptions{PollingMode::Blocking, ReadyPolicy::Inline});
+
+    auto waitable = make_unique<WaitableMock>();
+    auto throwingWaitable = make_unique<WaitableMock>();
+
+    EXPECT_CALL(*waitable, wait(microseconds(0))).WillOnce(Return(true));
+    EXPECT_CALL(*waitable, dispatch(IsNull())).Times(1);
+
+    EXPECT_CALL(*throwingWaitable, wait(microseconds(0))).WillOnce(Throw(runtime_error("Oops!")));
+    EXPECT_CALL(*throwingWaitable, dispatch(NotNull())).Times(1);
+
+    EXPECT_CALL(*invoker_, invoke(_)).Times(0);
+
+    poller_->watch(move(waitable));
+    poller_->watch(move(throwingWaitable));
+}
+
+TEST_F(PollingExecutorTest, NotReadyWaitableIsPolledDespiteReadyPolicy)
+{
+    poller_ = make_shared<Executor>(
+        milliseconds(10), invoker_, PollingOptions{PollingMode::Blocking, ReadyPolicy::Inline});
+
+    auto waitable = make_unique<WaitableMock>();
+
+    EXPECT_CALL(*waitable, wait(microseconds(0))).WillOnce(Return(false));
+    EXPECT_CALL(*waitable, wait(microseconds(10000))).WillOnce(Return(true));
+
+    EXPECT_CALL(*waitable, dispatch(IsNull())).Times(1);
+
+    function<void()> f, g;
+    EXPECT_CALL(*invoker_, invoke(_)).WillOnce(SaveArg<0>(&f)).WillOnce(SaveArg<0>(&g));
+
+    poller_->watch(move(waitable));
+
+    f(); // Poll
+    g(); // Dispatch
+}
+
+TEST(PendingWaitableTest, BacksOffOnceItsAgeDoubles)
+{
+    const auto since = std::chrono::steady_clock::now();
+    const PollingBackoff backoff{milliseconds(10), milliseconds(100)};
+
+    PendingWaitable p(make_unique<WaitableMock>(), since);
+    EXPECT_TRUE(p.isDue(since));
+
+    p.backOff(backoff, since + milliseconds(5));
+    EXPECT_TRUE(p.isDue(since + milliseconds(5)));
+
+    p.backOff(backoff, since + milliseconds(10));
+    EXPECT_FALSE(p.isDue(since + milliseconds(19)));
+    EXPECT_TRUE(p.isDue(since + milliseconds(20)));
+
+    p.backOff(backoff, since + milliseconds(20));
+    EXPECT_TRUE(p.isDue(since + milliseconds(40)));
+
+    p.backOff(backoff, since + milliseconds(400));
+    EXPECT_FALSE(p.isDue(since + milliseconds(499)));
+    EXPECT_TRUE(p.isDue(since + milliseconds(500)));
+}
+
+TEST(PendingWaitableTest, NeverBacksOffPastTheDeadline)
+{
+    const auto since = std::chrono::steady_clock::now();
+    const auto deadline = toEpochTimestamp(since) + milliseconds(50);
+    const PollingBackoff backoff{milliseconds(10), milliseconds(100)};
+
+    PendingWaitable p(make_unique<WaitableMock>(deadline), since);
+
+    p.backOff(backoff, since + milliseconds(40));
+    EXPECT_FALSE(p.isDue(since + milliseconds(40)));
+    EXPECT_TRUE(p.isDue(since + milliseconds(50)));
+
+    // Past the deadline, it is polled right away, so that it gets timed out
+    p.backOff(backoff, since + milliseconds(60));
+    EXPECT_TRUE(p.isDue(since + milliseconds(60)));
+}
+
+TEST(PendingWaitableTest, NoBackoffByDefault)
+{
+    const auto since = std::chrono::steady_clock::now();
+
+    PendingWaitable p(make_unique<WaitableMock>(), since);
+
+    p.backOff(PollingBackoff{}, since + seconds(10));
+    EXPECT_TRUE(p.isDue(since + seconds(10)));
+}
+
+TEST_F(PollingExecutorTest, BackoffPollsLongPendingWaitableLessOften)
+{
+    PollingOptions options;
+    options.mode = PollingMode::Sweep;
+    options.backoff.initial = milliseconds(5);
+
+    poller_ = make_shared<Executor>(milliseconds(1), invoker_, options);
+
+    auto waitable = make_unique<WaitableMock>();
+
+    // Without the backoff, it would be polled about once per ms
+    std::atomic<int> polls{0};
+    EXPECT_CALL(*waitable, wait(microseconds(0))).WillRepeatedly(Invoke([&polls](auto) {
+        ++polls;
+        return false;
+    }));
+    EXPECT_CALL(*waitable, dispatch(NotNull())).Times(1);
+
+    function<void()> f;
+    EXPECT_CALL(*invoker_, invoke(_))
+        .WillOnce(SaveArg<0>(&f))
+        .WillRepeatedly(Invoke([](function<void()> g) { g(); }));
+
+    poller_->watch(move(waitable));
+
+    std::thread poller(f);
+    std::this_thread::sleep_for(milliseconds(100));
+
+    poller_->stop();
+    poller.join();
+
+    EXPECT_THAT(polls.load(), Lt(30));
+}
+
+TEST(PollingExecutorBackoffTest, BlockingPollerSleepsWhileAllWaitablesBackOff)
+{
+    using Executor = PollingExecutor<InvokerWithNewThread, InvokerWithSingleThread, ExecutorStats>;
+
+    PollingOptions options;
+    options.backoff.initial = milliseconds(1);
+
+    auto executor = make_shared<Executor>(milliseconds(1), options);
+    ExecutorStats stats = executor->instrumentation();
+
+    auto waitable = make_unique<WaitableMock>();
+
+    EXPECT_CALL(*waitable, wait(_)).WillRepeatedly(Invoke([](const microseconds& q) {
+        std::this_thread::sleep_for(q);
+        return false;
+    }));
+
+    std::promise<void> cancelled;
+    EXPECT_CALL(*waitable, dispatch(NotNull()))
+        .WillOnce(Invoke([&cancelled](std::exception_ptr) { cancelled.set_value(); }));
+
+    executor->watch(move(waitable));
+    std::this_thread::sleep_for(milliseconds(100));
+
+    executor->stop();
+
+    EXPECT_EQ(std::future_status::ready, cancelled.get_future().wait_for(seconds(10)));
+
+    // The poller would spin, instead of sleeping for 1ms, if it did not poll anything
+    auto s = stats.snapshot();
+    EXPECT_THAT(s.waits, Lt(30U));
+    EXPECT_THAT(s.sweeps, Lt(200U));
+}
+
+TEST(PollingExecutorBackoffTest, PartialSortPollsLongPendingWaitableLessOften)
+{
+    using Executor = PollingExecutorWithPartialSort<InvokerWithNewThread, InvokerWithSingleThread>;
+
+    auto executor = make_shared<Executor>(milliseconds(1), PollingBackoff{milliseconds(5)});
+
+    auto waitable = make_unique<WaitableMock>();
+
+    std::atomic<int> polls{0};
+    EXPECT_CALL(*waitable, wait(_)).WillRepeatedly(Invoke([&polls](const microseconds& q) {
+        ++polls;
+        std::this_thread::sleep_for(q);
+        return false;
+    }));
+
+    std::promise<void> cancelled;
+    EXPECT_CALL(*waitable, dispatch(NotNull()))
+        .WillOnce(Invoke([&cancelled](std::exception_ptr) { cancelled.set_value(); }));
+
+    executor->watch(move(waitable));
+    std::this_thread::sleep_for(milliseconds(100));
+
+    executor->stop();
+
+    EXPECT_EQ(std::future_status::ready, cancelled.get_future().wait_for(seconds(10)));
+    EXPECT_THAT(polls.load(), Lt(30));
+}
+
+TEST(PollingExecutorBackoffTest, PartialSortTimesOutBackedOffWaitableOnTime)
+{
+    using Executor = PollingExecutorWithPartialSort<InvokerWithNewThread, InvokerWithSingleThread>;
+
+    auto executor = make_shared<Executor>(milliseconds(1),
+                                          PollingBackoff{milliseconds(200), seconds(1)});
+
+    std::promise<std::exception_ptr> p;
+    auto dispatched = p.get_future();
+
+    // Backing off at 200ms would postpone the next poll to 400ms, long past the deadline
+    const auto start = std::chrono::steady_clock::now();
+    executor->watch(make_unique<NeverReadyWaitable>(milliseconds(250), move(p)));
+
+    ASSERT_EQ(std::future_status::ready, dispatched.wait_for(seconds(10)));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THROW(std::rethrow_exception(dispatched.get()), WaitableTimedOutException);
+    EXPECT_THAT(elapsed, Lt(milliseconds(350)));
+
+    executor->stop();
+}
+
+TEST(PollingExecutorBackoffTest, PartialSortWakesUpSleepingPollerOnWatch)
+{
+    using Executor = PollingExecutorWithPartialSort<InvokerWithNewThread, InvokerWithSingleThread>;
+
+    auto executor = make_shared<Executor>(seconds(2), PollingBackoff{milliseconds(1)});
+
+    auto pending = make_unique<WaitableMock>();
+
+    // It is destroyed on the dispatch thread, possibly after the test returns; its
+    // cancellation is verified through the promise instead
+    Mock::AllowLeak(pending.get());
+
+    std::promise<void> cancelled;
+    EXPECT_CALL(*pending, wait(_)).WillRepeatedly(Return(false));
+    EXPECT_CALL(*pending, dispatch(NotNull()))
+        .WillOnce(Invoke([&cancelled](std::exception_ptr) { cancelled.set_value(); }));
+
+    executor->watch(move(pending));
+
+    // Let the pending waitable back off, so that the poller sleeps for 2s
+    std::this_thread::sleep_for(milliseconds(50));
+
+    auto ready = make_unique<WaitableMock>();
+
+    std::promise<void> dispatched;
+    EXPECT_CALL(*ready, wait(_)).WillOnce(Return(true));
+    EXPECT_CALL(*ready, dispatch(IsNull()))
+        .WillOnce(Invoke([&dispatched](std::exception_ptr) { dispatched.set_value(); }));
+
+    executor->watch(move(ready));
+
+    EXPECT_EQ(std::future_status::ready, dispatched.get_future().wait_for(milliseconds(500)));
+
+    executor->stop();
+
+    // Stopping wakes the poller up as well, which then cancels the pending waitable
+    EXPECT_EQ(std::future_status::ready, cancelled.get_future().wait_for(milliseconds(500)));
+}
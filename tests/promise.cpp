@@ -0,0 +1,226 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/observe.h>
+#include <thousandeyes/futures/Promise.h>
+#include <thousandeyes/futures/then.h>
+#include <thousandeyes/futures/util.h>
+
+using std::future;
+using std::future_error;
+using std::future_status;
+using std::make_shared;
+using std::move;
+using std::shared_ptr;
+using std::string;
+using std::thread;
+using std::to_string;
+using std::unique_ptr;
+using std::vector;
+using std::chrono::hours;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+using thousandeyes::futures::Default;
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::fromValue;
+using thousandeyes::futures::observe;
+using thousandeyes::futures::Promise;
+using thousandeyes::futures::then;
+using thousandeyes::futures::Waitable;
+using thousandeyes::futures::WaitableWaitException;
+
+using ::testing::Test;
+
+namespace {
+
+class RecordingExecutor : public Executor {
+public:
+    void watch(unique_ptr<Waitable> w) override
+    {
+        watched.push_back(move(w));
+    }
+
+    void ready(unique_ptr<Waitable> w) override
+    {
+        ++readyCount;
+        w->dispatch(nullptr);
+    }
+
+    void stop() override
+    {}
+
+    vector<unique_ptr<Waitable>> watched;
+    int readyCount{0};
+};
+
+} // namespace
+
+class PromiseTest : public Test {
+public:
+    PromiseTest() : executor_(make_shared<RecordingExecutor>())
+    {}
+
+protected:
+    shared_ptr<RecordingExecutor> executor_;
+};
+
+TEST_F(PromiseTest, ThenRunsContinuationWhenPromiseIsSet)
+{
+    Promise<int> p;
+
+    auto f = then(executor_, p.get_future(), [](future<int> f) { return to_string(f.get()); });
+
+    EXPECT_TRUE(executor_->watched.empty());
+    EXPECT_EQ(0, executor_->readyCount);
+    EXPECT_EQ(future_status::timeout, f.wait_for(milliseconds(0)));
+
+    p.set_value(1821);
+
+    EXPECT_TRUE(executor_->watched.empty());
+    EXPECT_EQ(1, executor_->readyCount);
+    EXPECT_EQ("1821", f.get());
+}
+
+TEST_F(PromiseTest, ThenOnSatisfiedPromiseRunsContinuationImmediately)
+{
+    Promise<void> p;
+    p.set_value();
+
+    auto f = then(executor_, p.get_future(), [](future<void> f) {
+        f.get();
+        return 1821;
+    });
+
+    EXPECT_EQ(1, executor_->readyCount);
+    EXPECT_EQ(1821, f.get());
+}
+
+TEST_F(PromiseTest, ThenPropagatesBrokenPromise)
+{
+    future<int> f;
+    {
+        Promise<int> p;
+        f = then(executor_, p.get_future(), [](future<int> f) { return f.get(); });
+    }
+
+    EXPECT_EQ(1, executor_->readyCount);
+    EXPECT_THROW(f.get(), future_error);
+}
+
+TEST_F(PromiseTest, ThenWithTimeLimitPollsFuture)
+{
+    Promise<int> p;
+
+    auto f = then(executor_, hours(1), p.get_future(), [](future<int> f) { return f.get(); });
+
+    EXPECT_EQ(1U, executor_->watched.size());
+
+    p.set_value(1821);
+
+    EXPECT_EQ(0, executor_->readyCount);
+}
+
+TEST_F(PromiseTest, ObserveRunsContinuationWhenPromiseIsSet)
+{
+    Promise<string> p;
+
+    string result;
+    observe(executor_, p.get_future(), [&result](future<string> f) { result = f.get(); });
+
+    EXPECT_TRUE(result.empty());
+
+    p.set_value("1821");
+
+    EXPECT_EQ(1, executor_->readyCount);
+    EXPECT_EQ("1821", result);
+}
+
+TEST_F(PromiseTest, ThenForwardsReturnedFutureWithoutPolling)
+{
+    Promise<void> outer;
+    Promise<int> inner;
+
+    auto f = then(executor_, outer.get_future(), [&inner](future<void> /* f */) {
+        return inner.get_future();
+    });
+
+    outer.set_value();
+
+    EXPECT_TRUE(executor_->watched.empty());
+    EXPECT_EQ(1, executor_->readyCount);
+    EXPECT_EQ(future_status::timeout, f.wait_for(milliseconds(0)));
+
+    inner.set_value(1821);
+
+    EXPECT_TRUE(executor_->watched.empty());
+    EXPECT_EQ(2, executor_->readyCount);
+    EXPECT_EQ(1821, f.get());
+}
+
+TEST_F(PromiseTest, ParkedContinuationDoesNotKeepExecutorAlive)
+{
+    Promise<int> p;
+
+    auto f = then(executor_, p.get_future(), [](future<int> f) { return f.get(); });
+
+    std::weak_ptr<RecordingExecutor> executor = executor_;
+    executor_.reset();
+
+    EXPECT_TRUE(executor.expired());
+
+    p.set_value(1821);
+
+    EXPECT_THROW(f.get(), WaitableWaitException);
+}
+
+TEST(PromiseWithDefaultExecutorTest, StoppingExecutorCancelsParkedContinuation)
+{
+    auto executor = make_shared<DefaultExecutor>(milliseconds(10));
+
+    Promise<int> p;
+
+    auto f = then(executor, p.get_future(), [](future<int> f) { return f.get(); });
+
+    executor->stop();
+
+    p.set_value(1821);
+
+    EXPECT_EQ(future_status::ready, f.wait_for(seconds(10)));
+    EXPECT_THROW(f.get(), WaitableWaitException);
+}
+
+TEST(PromiseWithDefaultExecutorTest, ThenWithChainingAcrossThreads)
+{
+    auto executor = make_shared<DefaultExecutor>(milliseconds(10));
+    Default<Executor>::Setter execSetter(executor);
+
+    Promise<int> p;
+
+    auto f = then(p.get_future(), [](future<int> f) { return fromValue(to_string(f.get())); });
+
+    thread t([p = move(p)]() mutable { p.set_value(1821); });
+
+    EXPECT_EQ(future_status::ready, f.wait_for(seconds(10)));
+    EXPECT_EQ("1821", f.get());
+
+    t.join();
+    executor->stop();
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/detail/FutureWithReduction.h>
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/reduce.h>
+#include <thousandeyes/futures/util.h>
+
+using std::future;
+using std::make_shared;
+using std::make_unique;
+using std::promise;
+using std::runtime_error;
+using std::shared_future;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+using std::chrono::hours;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+using std::chrono::steady_clock;
+
+using thousandeyes::futures::Default;
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::fromException;
+using thousandeyes::futures::fromValue;
+using thousandeyes::futures::reduce;
+using thousandeyes::futures::WaitableTimedOutException;
+using thousandeyes::futures::detail::FutureWithReduction;
+
+using ::testing::ElementsAre;
+using ::testing::Test;
+
+namespace {
+
+class SomeKindOfError : public runtime_error {
+public:
+    SomeKindOfError() : runtime_error("Some Kind Of Error")
+    {}
+};
+
+class ReduceTest : public Test {
+protected:
+    void SetUp() override
+    {
+        executor_ = make_shared<DefaultExecutor>(milliseconds(1));
+        setter_ = make_unique<Default<Executor>::Setter>(executor_);
+    }
+
+    void TearDown() override
+    {
+        executor_->stop();
+        setter_.reset();
+    }
+
+    std::shared_ptr<DefaultExecutor> executor_;
+    unique_ptr<Default<Executor>::Setter> setter_;
+};
+
+} // namespace
+
+TEST_F(ReduceTest, Sum)
+{
+    vector<future<int>> futures;
+    for (int i = 0; i < 1821; ++i) {
+        futures.push_back(std::async(std::launch::async, [i]() { return i; }));
+    }
+
+    auto f = reduce(std::move(futures), 0L, [](long sum, future<int> f) { return sum + f.get(); });
+
+    EXPECT_EQ(1821L * 1820L / 2, f.get());
+}
+
+TEST_F(ReduceTest, FoldsInCompletionOrder)
+{
+    vector<promise<string>> promises(3);
+
+    vector<future<string>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto f = reduce(executor_,
+                    std::move(futures),
+                    vector<string>(),
+                    [](vector<string> acc, future<string> f) {
+                        acc.push_back(f.get());
+                        return acc;
+                    });
+
+    promises[1].set_value("1");
+    std::this_thread::sleep_for(milliseconds(10));
+    promises[2].set_value("2");
+    std::this_thread::sleep_for(milliseconds(10));
+    promises[0].set_value("0");
+
+    EXPECT_THAT(f.get(), ElementsAre("1", "2", "0"));
+}
+
+TEST_F(ReduceTest, OperationHandlesExceptionsOfInputs)
+{
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1821));
+    futures.push_back(fromException<int>(std::make_exception_ptr(SomeKindOfError())));
+
+    auto f = reduce(std::move(futures), 0, [](int failed, future<int> f) {
+        try {
+            f.get();
+            return failed;
+        }
+        catch (const SomeKindOfError&) {
+            return failed + 1;
+        }
+    });
+
+    EXPECT_EQ(1, f.get());
+}
+
+TEST_F(ReduceTest, OperationThrows)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1821));
+    futures.push_back(never.get_future());
+
+    auto f = reduce(std::move(futures), 0, [](int, future<int> /* f */) -> int {
+        throw SomeKindOfError();
+    });
+
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}
+
+TEST_F(ReduceTest, SharedFutures)
+{
+    vector<shared_future<int>> futures;
+    futures.push_back(fromValue(1821));
+    futures.push_back(futures[0]);
+
+    auto f = reduce(futures, 0, [](int sum, shared_future<int> f) { return sum + f.get(); });
+
+    EXPECT_EQ(2 * 1821, f.get());
+}
+
+TEST_F(ReduceTest, EmptyContainer)
+{
+    auto f = reduce(vector<future<int>>(), 1821, [](int sum, future<int> f) {
+        return sum + f.get();
+    });
+
+    EXPECT_EQ(1821, f.get());
+}
+
+TEST_F(ReduceTest, TimesOut)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1821));
+    futures.push_back(never.get_future());
+
+    auto f = reduce(milliseconds(20), std::move(futures), 0, [](int sum, future<int> f) {
+        return sum + f.get();
+    });
+
+    EXPECT_THROW(f.get(), WaitableTimedOutException);
+}
+
+TEST(FutureWithReductionTest, FoldsReadyFuturesWhilePolling)
+{
+    promise<int> last;
+
+    vector<future<int>> futures;
+    futures.push_back(last.get_future());
+    futures.push_back(fromValue(1820));
+
+    int foldCount = 0;
+    auto op = [&foldCount](int acc, future<int> f) {
+        ++foldCount;
+        return acc + f.get();
+    };
+
+    promise<int> p;
+    auto f = p.get_future();
+
+    FutureWithReduction<future<int>, int, decltype(op)> waitable(
+        milliseconds(100), std::move(futures), 0, op, std::move(p));
+
+    EXPECT_FALSE(waitable.timedWait(microseconds(0)));
+    EXPECT_EQ(1, foldCount);
+
+    last.set_value(1);
+
+    // Once all the futures are folded, it stays ready until dispatched
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+    EXPECT_TRUE(waitable.timedWait(microseconds(0)));
+    EXPECT_EQ(2, foldCount);
+
+    waitable.dispatch(nullptr);
+
+    EXPECT_EQ(1821, f.get());
+}
+
+TEST(FutureWithReductionTest, RotatesTheFutureItBlocksOn)
+{
+    vector<promise<int>> promises(2);
+
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto op = [](int acc, future<int> f) { return acc + f.get(); };
+
+    promise<int> p;
+    FutureWithReduction<future<int>, int, decltype(op)> waitable(
+        hours(1), std::move(futures), 0, op, std::move(p));
+
+    // Blocks on the first future
+    EXPECT_FALSE(waitable.timedWait(milliseconds(1)));
+
+    std::thread t([&promises]() {
+        std::this_thread::sleep_for(milliseconds(20));
+        promises[1].set_value(1821);
+    });
+
+    // Blocks on the second future, instead of the first one that never becomes ready
+    const auto start = steady_clock::now();
+    EXPECT_FALSE(waitable.timedWait(seconds(10)));
+    EXPECT_LT(steady_clock::now() - start, seconds(5));
+
+    t.join();
+
+    promises[0].set_value(0);
+    EXPECT_TRUE(waitable.timedWait(milliseconds(1)));
+}
@@ -0,0 +1,286 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/detail/InvokerWithPersistentThread.h>
+#include <thousandeyes/futures/detail/InvokerWithSingleThread.h>
+#include <thousandeyes/futures/ExecutorStats.h>
+#include <thousandeyes/futures/ShardedPollingExecutor.h>
+#include <thousandeyes/futures/Waitable.h>
+
+using std::function;
+using std::make_shared;
+using std::make_unique;
+using std::move;
+using std::shared_ptr;
+using std::vector;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+using thousandeyes::futures::ExecutorStats;
+using thousandeyes::futures::ShardedPollingExecutor;
+using thousandeyes::futures::Waitable;
+using thousandeyes::futures::detail::InvokerWithPersistentThread;
+using thousandeyes::futures::detail::InvokerWithSingleThread;
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::IsNull;
+using ::testing::NotNull;
+using ::testing::Return;
+using ::testing::Test;
+
+namespace {
+
+class WaitableMock : public Waitable {
+public:
+    MOCK_METHOD1(wait, bool(const std::chrono::microseconds& timeout));
+
+    MOCK_METHOD1(dispatch, void(std::exception_ptr err));
+};
+
+class Invoker {
+public:
+    MOCK_METHOD1(invoke, void(function<void()> f));
+};
+
+class DispatcherFunctor {
+public:
+    explicit DispatcherFunctor(shared_ptr<Invoker> invoker) : invoker_(move(invoker))
+    {}
+
+    void operator()(function<void()> f)
+    {
+        invoker_->invoke(move(f));
+    }
+
+private:
+    shared_ptr<Invoker> invoker_;
+};
+
+using Executor = ShardedPollingExecutor<DispatcherFunctor, DispatcherFunctor>;
+
+} // namespace
+
+class ShardedPollingExecutorTest : public Test {
+public:
+    ShardedPollingExecutorTest() :
+        invoker_(make_shared<Invoker>()),
+        executor_(make_shared<Executor>(milliseconds(10),
+                                        3,
+                                        [this]() { return DispatcherFunctor(invoker_); },
+                                        [this]() { return DispatcherFunctor(invoker_); }))
+    {}
+
+protected:
+    shared_ptr<Invoker> invoker_;
+    shared_ptr<Executor> executor_;
+};
+
+TEST_F(ShardedPollingExecutorTest, AtLeastOneShard)
+{
+    auto executor = make_shared<Executor>(milliseconds(10),
+                                          0,
+                                          [this]() { return DispatcherFunctor(invoker_); },
+                                          [this]() { return DispatcherFunctor(invoker_); });
+
+    EXPECT_EQ(1U, executor->shardCount());
+}
+
+TEST_F(ShardedPollingExecutorTest, StartsOnePollerPerShard)
+{
+    vector<function<void()>> fs;
+    EXPECT_CALL(*invoker_, invoke(_)).WillRepeatedly(Invoke([&fs](function<void()> f) {
+        fs.push_back(move(f));
+    }));
+
+    for (int i = 0; i < 3; ++i) {
+        auto waitable = make_unique<WaitableMock>();
+
+        EXPECT_CALL(*waitable, wait(microseconds(10000))).WillOnce(Return(true));
+        EXPECT_CALL(*waitable, dispatch(IsNull())).Times(1);
+
+        executor_->watch(move(waitable));
+    }
+
+    // Every waitable lands on a different shard, hence every shard starts its own poller
+    ASSERT_EQ(3U, fs.size());
+
+    for (int i = 0; i < 3; ++i) {
+        fs[i](); // Poll
+    }
+
+    ASSERT_EQ(6U, fs.size());
+
+    for (int i = 3; i < 6; ++i) {
+        fs[i](); // Dispatch
+    }
+}
+
+TEST_F(ShardedPollingExecutorTest, StopCancelsWaitablesOfAllShards)
+{
+    vector<function<void()>> fs;
+    EXPECT_CALL(*invoker_, invoke(_)).WillRepeatedly(Invoke([&fs](function<void()> f) {
+        fs.push_back(move(f));
+    }));
+
+    for (int i = 0; i < 3; ++i) {
+        auto waitable = make_unique<WaitableMock>();
+
+        EXPECT_CALL(*waitable, wait(_)).Times(0);
+        EXPECT_CALL(*waitable, dispatch(NotNull())).Times(1);
+
+        executor_->watch(move(waitable));
+    }
+
+    ASSERT_EQ(3U, fs.size());
+
+    executor_->stop();
+
+    ASSERT_EQ(6U, fs.size());
+
+    for (int i = 3; i < 6; ++i) {
+        fs[i](); // Dispatch cancellation
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        fs[i](); // Poll, after stopping
+    }
+}
+
+TEST_F(ShardedPollingExecutorTest, ReadyDispatchesWithoutPolling)
+{
+    vector<function<void()>> fs;
+    EXPECT_CALL(*invoker_, invoke(_)).WillRepeatedly(Invoke([&fs](function<void()> f) {
+        fs.push_back(move(f));
+    }));
+
+    auto waitable = make_unique<WaitableMock>();
+
+    EXPECT_CALL(*waitable, wait(_)).Times(0);
+    EXPECT_CALL(*waitable, dispatch(IsNull())).Times(1);
+
+    executor_->ready(move(waitable));
+
+    // No poller is started, the waitable is dispatched right away
+    ASSERT_EQ(1U, fs.size());
+
+    fs[0](); // Dispatch
+}
+
+TEST_F(ShardedPollingExecutorTest, CollectsMetricsPerShard)
+{
+    using Executor = ShardedPollingExecutor<DispatcherFunctor, DispatcherFunctor, ExecutorStats>;
+
+    auto executor = make_shared<Executor>(milliseconds(10),
+                                          3,
+                                          [this]() { return DispatcherFunctor(invoker_); },
+                                          [this]() { return DispatcherFunctor(invoker_); });
+
+    vector<function<void()>> fs;
+    EXPECT_CALL(*invoker_, invoke(_)).WillRepeatedly(Invoke([&fs](function<void()> f) {
+        fs.push_back(move(f));
+    }));
+
+    for (int i = 0; i < 3; ++i) {
+        auto waitable = make_unique<WaitableMock>();
+
+        EXPECT_CALL(*waitable, wait(_)).Times(0);
+        EXPECT_CALL(*waitable, dispatch(NotNull())).Times(1);
+
+        executor->watch(move(waitable));
+    }
+
+    for (std::size_t i = 0; i < executor->shardCount(); ++i) {
+        EXPECT_EQ(1U, executor->instrumentation(i).snapshot().watches);
+    }
+
+    executor->stop();
+
+    ASSERT_EQ(6U, fs.size());
+
+    for (int i = 3; i < 6; ++i) {
+        fs[i](); // Dispatch cancellation
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        fs[i](); // Poll, after stopping
+    }
+}
+
+TEST(ShardedPollingExecutorInvokersTest, TemporaryInvokersKeepEveryShardDispatching)
+{
+    using Executor = ShardedPollingExecutor<InvokerWithPersistentThread, InvokerWithSingleThread>;
+
+    // The invokers are temporaries, destroyed right after being handed to a shard
+    auto executor = make_shared<Executor>(
+        milliseconds(1),
+        3,
+        []() { return InvokerWithPersistentThread(); },
+        []() { return InvokerWithSingleThread(); });
+
+    vector<std::promise<void>> dispatched(6);
+
+    for (auto& p : dispatched) {
+        auto waitable = make_unique<WaitableMock>();
+
+        EXPECT_CALL(*waitable, wait(_)).WillRepeatedly(Return(true));
+        EXPECT_CALL(*waitable, dispatch(IsNull()))
+            .WillOnce(Invoke([&p](std::exception_ptr) { p.set_value(); }));
+
+        executor->watch(move(waitable));
+    }
+
+    for (auto& p : dispatched) {
+        EXPECT_EQ(std::future_status::ready, p.get_future().wait_for(seconds(10)));
+    }
+
+    executor->stop();
+}
+
+TEST(ShardedPollingExecutorInvokersTest, CopiedInvokerKeepsDispatchingUntilLastCopyIsGone)
+{
+    using Executor = ShardedPollingExecutor<InvokerWithPersistentThread, InvokerWithSingleThread>;
+
+    // Every shard gets a copy of the same invoker, hence they all share its thread
+    InvokerWithSingleThread invoker;
+    auto executor = make_shared<Executor>(
+        milliseconds(1),
+        3,
+        []() { return InvokerWithPersistentThread(); },
+        [&invoker]() { return invoker; });
+
+    vector<std::promise<void>> dispatched(6);
+
+    for (auto& p : dispatched) {
+        auto waitable = make_unique<WaitableMock>();
+
+        EXPECT_CALL(*waitable, wait(_)).WillRepeatedly(Return(true));
+        EXPECT_CALL(*waitable, dispatch(IsNull()))
+            .WillOnce(Invoke([&p](std::exception_ptr) { p.set_value(); }));
+
+        executor->watch(move(waitable));
+    }
+
+    for (auto& p : dispatched) {
+        EXPECT_EQ(std::future_status::ready, p.get_future().wait_for(seconds(10)));
+    }
+
+    executor->stop();
+}
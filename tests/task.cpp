@@ -0,0 +1,146 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/detail/InvokerWithNewThread.h>
+#include <thousandeyes/futures/detail/InvokerWithSingleThread.h>
+#include <thousandeyes/futures/detail/InvokerWithThreadPool.h>
+#include <thousandeyes/futures/detail/Task.h>
+
+using std::array;
+using std::atomic;
+using std::exception_ptr;
+using std::function;
+using std::make_shared;
+using std::make_unique;
+using std::move;
+using std::shared_ptr;
+using std::unique_ptr;
+
+namespace detail = thousandeyes::futures::detail;
+
+using detail::Task;
+
+namespace {
+
+atomic<int> allocationCount{0};
+
+struct FunctionInvoker {
+    void operator()(function<void()> f)
+    {
+        f();
+    }
+};
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t /* size */) noexcept
+{
+    std::free(p);
+}
+
+static_assert(detail::accepts_task<detail::InvokerWithNewThread>::value, "");
+static_assert(detail::accepts_task<detail::InvokerWithSingleThread>::value, "");
+static_assert(detail::accepts_task<detail::InvokerWithThreadPool>::value, "");
+static_assert(!detail::accepts_task<FunctionInvoker>::value, "");
+
+TEST(TaskTest, InvokesMoveOnlyCallable)
+{
+    int result = 0;
+    auto value = make_unique<int>(1821);
+
+    Task task([&result, value = move(value)]() { result = *value; });
+    ASSERT_TRUE(task);
+
+    task();
+
+    EXPECT_EQ(1821, result);
+}
+
+TEST(TaskTest, StoresSmallCallableWithoutAllocating)
+{
+    auto value = make_unique<int>(1821);
+    exception_ptr error;
+    int result = 0;
+
+    int before = allocationCount.load();
+
+    Task task([&result, value = move(value), error]() { result = error ? 0 : *value; });
+    Task other(move(task));
+    task = move(other);
+    task();
+
+    EXPECT_EQ(before, allocationCount.load());
+    EXPECT_EQ(1821, result);
+}
+
+TEST(TaskTest, StoresLargeCallable)
+{
+    auto counter = make_shared<int>(0);
+    array<int, 64> values;
+    values.fill(1);
+
+    {
+        Task task([counter, values]() {
+            for (int v : values) {
+                *counter += v;
+            }
+        });
+
+        Task other(move(task));
+        EXPECT_FALSE(task);
+
+        other();
+        EXPECT_EQ(2, counter.use_count());
+    }
+
+    EXPECT_EQ(64, *counter);
+    EXPECT_EQ(1, counter.use_count());
+}
+
+TEST(TaskTest, MoveAssignmentDestroysPreviousCallable)
+{
+    auto first = make_shared<int>(0);
+    auto second = make_shared<int>(0);
+
+    Task task([first]() { ++*first; });
+    EXPECT_EQ(2, first.use_count());
+
+    task = Task([second]() { ++*second; });
+    EXPECT_EQ(1, first.use_count());
+    EXPECT_EQ(2, second.use_count());
+
+    task = Task();
+    EXPECT_FALSE(task);
+    EXPECT_EQ(1, second.use_count());
+}
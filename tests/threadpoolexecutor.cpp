@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/then.h>
+#include <thousandeyes/futures/util.h>
+
+using std::atomic;
+using std::future;
+using std::future_status;
+using std::make_shared;
+using std::move;
+using std::promise;
+using std::string;
+using std::to_string;
+using std::vector;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+using std::this_thread::sleep_for;
+
+using thousandeyes::futures::Default;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::fromValue;
+using thousandeyes::futures::then;
+using thousandeyes::futures::ThreadPoolExecutor;
+
+namespace detail = thousandeyes::futures::detail;
+
+using ::testing::Test;
+
+TEST(InvokerWithThreadPoolTest, RunsAllFunctions)
+{
+    detail::InvokerWithThreadPool invoker(4);
+
+    atomic<int> count{0};
+    promise<void> done;
+
+    for (int i = 0; i < 1821; ++i) {
+        invoker([&]() {
+            if (++count == 1821) {
+                done.set_value();
+            }
+        });
+    }
+
+    auto f = done.get_future();
+    ASSERT_EQ(future_status::ready, f.wait_for(seconds(10)));
+    EXPECT_EQ(1821, count.load());
+}
+
+TEST(InvokerWithThreadPoolTest, RunsFunctionsInvokedFromPoolThreads)
+{
+    detail::InvokerWithThreadPool invoker(2);
+
+    atomic<int> count{0};
+    promise<void> done;
+
+    for (int i = 0; i < 100; ++i) {
+        invoker([&]() {
+            for (int j = 0; j < 10; ++j) {
+                invoker([&]() {
+                    if (++count == 1000) {
+                        done.set_value();
+                    }
+                });
+            }
+        });
+    }
+
+    auto f = done.get_future();
+    ASSERT_EQ(future_status::ready, f.wait_for(seconds(10)));
+    EXPECT_EQ(1000, count.load());
+}
+
+TEST(ThreadPoolExecutorTest, ThenWithoutExceptionMultipleFutures)
+{
+    auto executor = make_shared<ThreadPoolExecutor>(milliseconds(10));
+    Default<Executor>::Setter execSetter(executor);
+
+    vector<future<string>> f;
+    for (int i = 0; i < 1821; ++i) {
+        f.push_back(then(fromValue(i), [](future<int> f) { return to_string(f.get()); }));
+    }
+
+    for (int i = 0; i < 1821; ++i) {
+        EXPECT_EQ(to_string(i), f[i].get());
+    }
+
+    executor->stop();
+}
+
+TEST(ThreadPoolExecutorTest, SlowContinuationDoesNotStallOthers)
+{
+    auto executor = make_shared<ThreadPoolExecutor>(milliseconds(10),
+                                                    detail::InvokerWithPersistentThread(),
+                                                    detail::InvokerWithThreadPool(2));
+    Default<Executor>::Setter execSetter(executor);
+
+    promise<void> unblock;
+    auto unblocked = unblock.get_future();
+
+    // With a single dispatching thread the first continuation would block the
+    // second one until it gives up waiting.
+    auto f = then(fromValue(), [&unblocked](future<void> /* f */) {
+        return unblocked.wait_for(seconds(10)) == future_status::ready;
+    });
+
+    sleep_for(milliseconds(50));
+
+    auto g = then(fromValue(), [&unblock](future<void> /* f */) { unblock.set_value(); });
+
+    EXPECT_NO_THROW(g.get());
+    EXPECT_TRUE(f.get());
+
+    executor->stop();
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/detail/TimerWheel.h>
+
+using std::mt19937;
+using std::uniform_int_distribution;
+using std::vector;
+using std::chrono::hours;
+using std::chrono::milliseconds;
+
+using thousandeyes::futures::detail::TimerWheel;
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::UnorderedElementsAre;
+
+TEST(TimerWheelTest, ExpiresItemsAtTheirDeadline)
+{
+    TimerWheel<int> wheel(milliseconds(1000));
+
+    wheel.insert(milliseconds(1001), 1);
+    wheel.insert(milliseconds(1065), 2);
+    wheel.insert(milliseconds(5000), 3);
+
+    vector<int> expired;
+    auto onExpired = [&expired](int i) { expired.push_back(i); };
+
+    wheel.advance(milliseconds(1000), onExpired);
+    EXPECT_THAT(expired, IsEmpty());
+
+    wheel.advance(milliseconds(1001), onExpired);
+    EXPECT_THAT(expired, ElementsAre(1));
+
+    wheel.advance(milliseconds(1064), onExpired);
+    EXPECT_THAT(expired, ElementsAre(1));
+
+    wheel.advance(milliseconds(1065), onExpired);
+    EXPECT_THAT(expired, ElementsAre(1, 2));
+
+    wheel.advance(milliseconds(4999), onExpired);
+    EXPECT_THAT(expired, ElementsAre(1, 2));
+
+    wheel.advance(milliseconds(5000), onExpired);
+    EXPECT_THAT(expired, ElementsAre(1, 2, 3));
+
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, ExpiresPastDeadlinesOnNextAdvance)
+{
+    TimerWheel<int> wheel(milliseconds(1000));
+
+    wheel.insert(milliseconds(1), 1);
+    wheel.insert(milliseconds(1000), 2);
+
+    EXPECT_EQ(2U, wheel.size());
+
+    vector<int> expired;
+    wheel.advance(milliseconds(1000), [&expired](int i) { expired.push_back(i); });
+
+    EXPECT_THAT(expired, UnorderedElementsAre(1, 2));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, ItemsWithoutDeadlineNeverExpire)
+{
+    TimerWheel<int> wheel(milliseconds(1000));
+
+    wheel.insert(milliseconds(0), 1);
+
+    vector<int> expired;
+    wheel.advance(hours(1821), [&expired](int i) { expired.push_back(i); });
+
+    EXPECT_THAT(expired, IsEmpty());
+    EXPECT_EQ(1U, wheel.size());
+}
+
+TEST(TimerWheelTest, RemoveIfVisitsAllItems)
+{
+    TimerWheel<int> wheel(milliseconds(1000));
+
+    wheel.insert(milliseconds(0), 0);
+    wheel.insert(milliseconds(1010), 1);
+    wheel.insert(milliseconds(2000), 2);
+    wheel.insert(milliseconds(1000 + 5 * 3600 * 1000), 3);
+
+    vector<int> visited;
+    wheel.removeIf([&visited](int& i) {
+        visited.push_back(i);
+        return i % 2 == 1;
+    });
+
+    EXPECT_THAT(visited, ElementsAre(1, 2, 3, 0));
+    EXPECT_EQ(2U, wheel.size());
+
+    vector<int> cleared;
+    wheel.clear([&cleared](int i) { cleared.push_back(i); });
+
+    EXPECT_THAT(cleared, ElementsAre(2, 0));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, ExpiresRandomDeadlinesInOrder)
+{
+    mt19937 gen;
+    uniform_int_distribution<std::int64_t> dist(1, 6 * 3600 * 1000);
+
+    const std::int64_t t0 = 1821;
+    TimerWheel<std::int64_t> wheel{milliseconds(t0)};
+
+    for (int i = 0; i < 1821; ++i) {
+        auto deadline = t0 + dist(gen);
+        wheel.insert(milliseconds(deadline), deadline);
+    }
+
+    std::int64_t now = t0;
+    std::size_t count = 0;
+    while (!wheel.empty()) {
+        now += dist(gen) % 100000;
+
+        wheel.advance(milliseconds(now), [now, &count](std::int64_t deadline) {
+            EXPECT_LE(deadline, now);
+            ++count;
+        });
+
+        wheel.removeIf([now](std::int64_t& deadline) {
+            EXPECT_GT(deadline, now);
+            return false;
+        });
+    }
+
+    EXPECT_EQ(1821U, count);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/detail/WaitablePool.h>
+#include <thousandeyes/futures/Waitable.h>
+
+using std::make_unique;
+using std::thread;
+using std::unique_ptr;
+using std::vector;
+
+using thousandeyes::futures::Waitable;
+using thousandeyes::futures::detail::WaitablePool;
+
+namespace {
+
+template <std::size_t N>
+class SizedWaitable : public Waitable {
+public:
+    bool wait(const std::chrono::microseconds& /* q */) override
+    {
+        return true;
+    }
+
+    void dispatch(std::exception_ptr /* err */) override
+    {}
+
+private:
+    char payload_[N];
+};
+
+bool isMaxAligned(const void* p)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % alignof(std::max_align_t) == 0;
+}
+
+} // namespace
+
+TEST(WaitablePoolTest, ReusesFreedBlocksOfTheSameSizeClass)
+{
+    void* p = WaitablePool::allocate(40);
+    EXPECT_TRUE(isMaxAligned(p));
+    WaitablePool::deallocate(p);
+
+    void* q = WaitablePool::allocate(48);
+    EXPECT_EQ(p, q);
+    WaitablePool::deallocate(q);
+}
+
+TEST(WaitablePoolTest, AllocatesLargeBlocks)
+{
+    void* p = WaitablePool::allocate(1821);
+    EXPECT_TRUE(isMaxAligned(p));
+    WaitablePool::deallocate(p);
+
+    WaitablePool::deallocate(nullptr);
+}
+
+TEST(WaitablePoolTest, WaitablesAreAllocatedFromThePool)
+{
+    unique_ptr<Waitable> small = make_unique<SizedWaitable<8>>();
+    unique_ptr<Waitable> medium = make_unique<SizedWaitable<200>>();
+    unique_ptr<Waitable> large = make_unique<SizedWaitable<1821>>();
+
+    EXPECT_TRUE(isMaxAligned(small.get()));
+    EXPECT_TRUE(isMaxAligned(medium.get()));
+    EXPECT_TRUE(isMaxAligned(large.get()));
+
+    void* p = small.get();
+    small.reset();
+
+    small = make_unique<SizedWaitable<8>>();
+    EXPECT_EQ(p, small.get());
+}
+
+TEST(WaitablePoolTest, RecyclesBlocksFreedOnOtherThreads)
+{
+    for (int round = 0; round < 10; ++round) {
+        vector<unique_ptr<Waitable>> waitables;
+        for (int i = 0; i < 1821; ++i) {
+            waitables.push_back(make_unique<SizedWaitable<64>>());
+        }
+
+        thread([&waitables]() { waitables.clear(); }).join();
+    }
+
+    // Blocks returned to the global list by the exited threads are reused
+    vector<unique_ptr<Waitable>> waitables;
+    for (int i = 0; i < 1821; ++i) {
+        waitables.push_back(make_unique<SizedWaitable<64>>());
+    }
+}
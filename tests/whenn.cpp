@@ -0,0 +1,216 @@
+/*
+ * Copyright 2026 ThousandEyes, Inc.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ */
+
+#include <chrono>
+#include <future>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thousandeyes/futures/DefaultExecutor.h>
+#include <thousandeyes/futures/util.h>
+#include <thousandeyes/futures/whenN.h>
+
+using std::future;
+using std::future_status;
+using std::get;
+using std::invalid_argument;
+using std::list;
+using std::make_shared;
+using std::promise;
+using std::runtime_error;
+using std::string;
+using std::vector;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+using thousandeyes::futures::Default;
+using thousandeyes::futures::DefaultExecutor;
+using thousandeyes::futures::Executor;
+using thousandeyes::futures::fromException;
+using thousandeyes::futures::fromValue;
+using thousandeyes::futures::WaitableTimedOutException;
+using thousandeyes::futures::whenN;
+
+using ::testing::Test;
+using ::testing::UnorderedElementsAre;
+
+namespace {
+
+class SomeKindOfError : public runtime_error {
+public:
+    SomeKindOfError() : runtime_error("Some kind of error")
+    {}
+};
+
+class WhenNTest : public Test {
+protected:
+    void SetUp() override
+    {
+        executor_ = make_shared<DefaultExecutor>(milliseconds(1));
+        setter_ = std::make_unique<Default<Executor>::Setter>(executor_);
+    }
+
+    void TearDown() override
+    {
+        executor_->stop();
+        setter_.reset();
+    }
+
+    std::shared_ptr<DefaultExecutor> executor_;
+    std::unique_ptr<Default<Executor>::Setter> setter_;
+};
+
+} // namespace
+
+TEST_F(WhenNTest, ResolvesWhenQuorumIsReady)
+{
+    vector<promise<int>> promises(5);
+
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto f = whenN(3, std::move(futures));
+
+    promises[4].set_value(4);
+    promises[1].set_value(1);
+    EXPECT_EQ(future_status::timeout, f.wait_for(milliseconds(20)));
+
+    promises[2].set_value(2);
+    ASSERT_EQ(future_status::ready, f.wait_for(seconds(5)));
+
+    auto result = f.get();
+    auto& ready = get<0>(result);
+    auto& rest = get<1>(result);
+
+    ASSERT_EQ(3U, ready.size());
+    ASSERT_EQ(2U, rest.size());
+    EXPECT_TRUE(get<2>(result).empty());
+
+    vector<int> values;
+    for (auto& fi : ready) {
+        values.push_back(fi.get());
+    }
+    EXPECT_THAT(values, UnorderedElementsAre(1, 2, 4));
+
+    // The rest are in their original order and can still be used
+    promises[0].set_value(0);
+    promises[3].set_value(3);
+    EXPECT_EQ(0, rest[0].get());
+    EXPECT_EQ(3, rest[1].get());
+}
+
+TEST_F(WhenNTest, TakesExactlyNWhenMoreAreReady)
+{
+    list<future<string>> futures;
+    futures.push_back(fromValue(string("a")));
+    futures.push_back(fromValue(string("b")));
+    futures.push_back(fromValue(string("c")));
+
+    auto result = whenN(2, std::move(futures)).get();
+
+    ASSERT_EQ(2U, get<0>(result).size());
+    ASSERT_EQ(1U, get<1>(result).size());
+    EXPECT_EQ("a", get<0>(result)[0].get());
+    EXPECT_EQ("b", get<0>(result)[1].get());
+    EXPECT_EQ("c", get<1>(result)[0].get());
+}
+
+TEST_F(WhenNTest, ZeroIsReadyRightAway)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(never.get_future());
+
+    auto result = whenN(0, std::move(futures)).get();
+
+    EXPECT_TRUE(get<0>(result).empty());
+    EXPECT_EQ(1U, get<1>(result).size());
+}
+
+TEST_F(WhenNTest, NotEnoughFutures)
+{
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1821));
+
+    auto f = whenN(2, std::move(futures));
+
+    EXPECT_THROW(f.get(), invalid_argument);
+}
+
+TEST_F(WhenNTest, TimesOut)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(fromValue(1821));
+    futures.push_back(never.get_future());
+
+    auto f = whenN(milliseconds(20), 2, std::move(futures));
+
+    EXPECT_THROW(f.get(), WaitableTimedOutException);
+}
+
+TEST_F(WhenNTest, FailuresDoNotCountTowardsQuorum)
+{
+    vector<promise<int>> promises(4);
+
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto f = whenN(2, std::move(futures));
+
+    promises[0].set_exception(std::make_exception_ptr(SomeKindOfError()));
+    promises[1].set_value(1);
+    EXPECT_EQ(future_status::timeout, f.wait_for(milliseconds(20)));
+
+    promises[3].set_value(3);
+    ASSERT_EQ(future_status::ready, f.wait_for(seconds(5)));
+
+    auto result = f.get();
+    auto& succeeded = get<0>(result);
+    auto& rest = get<1>(result);
+    auto& failed = get<2>(result);
+
+    ASSERT_EQ(2U, succeeded.size());
+    ASSERT_EQ(1U, rest.size());
+    ASSERT_EQ(1U, failed.size());
+
+    EXPECT_EQ(1, succeeded[0].get());
+    EXPECT_EQ(3, succeeded[1].get());
+    EXPECT_THROW(failed[0].get(), SomeKindOfError);
+
+    promises[2].set_value(2);
+    EXPECT_EQ(2, rest[0].get());
+}
+
+TEST_F(WhenNTest, FailsOnceQuorumIsOutOfReach)
+{
+    promise<int> never;
+
+    vector<future<int>> futures;
+    futures.push_back(never.get_future());
+    futures.push_back(fromValue(1821));
+    futures.push_back(fromException<int>(std::make_exception_ptr(SomeKindOfError())));
+
+    auto f = whenN(milliseconds(5000), 3, std::move(futures));
+
+    ASSERT_EQ(future_status::ready, f.wait_for(seconds(1)));
+    EXPECT_THROW(f.get(), SomeKindOfError);
+}